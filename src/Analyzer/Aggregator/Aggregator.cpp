@@ -11,24 +11,40 @@
  */
 
 #include "Aggregator/Aggregator.h"
+#include "Aggregator/AutomatonJumpDetector.h"
+#include "Aggregator/RollingHash.h"
 #include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
 
 #include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
 
 /**
  * @brief Constructor with members initialization.
  * Creates the first empty node in the graph, which represents starting point of the program.
  * Also creates jumps detector with specified minimal subroutine size and opens output file.
  * @param subroutineSize Minimal subroutine size for jump detector.
- * @throws ConfigurationException if output file can not be opened.
+ * @param jumps Type of jump detector (window or automaton).
+ * @param path Destination of the output file.
+ * @param graphMemory Maximal size of the memory used by the graph in bytes (0 if not limited).
+ * @param graphDir Directory of files of the graph (used only if its memory is limited).
+ * @param traceMemory Maximal size of the memory used by traces of jump detector in bytes (0 if
+ * not limited).
+ * @throws ConfigurationException if output file or files of the graph can not be opened.
  */
-Aggregator::Aggregator(unsigned subroutineSize, std::string path) :
-      graph(), currentNode(0), _nodeInserted(false) {
-   // Create and push back first empty node
-   graph.push_back(new GraphNode(NULL));
+Aggregator::Aggregator(unsigned subroutineSize, std::string jumps, std::string path,
+      size_t graphMemory, std::string graphDir, size_t traceMemory) :
+      graph(graphMemory, graphDir), currentNode(0), _nodeInserted(false) {
+   // Create first empty node
+   graph.addNode(symbols.intern(""));
    // Create jump detector
-   if (subroutineSize > 1)
-      jumpDetector = new JumpDetector(subroutineSize, this);
+   if (subroutineSize > 1 && jumps == "automaton")
+      jumpDetector = new AutomatonJumpDetector(subroutineSize, this);
+   else if (subroutineSize > 1)
+      jumpDetector = new JumpDetector(subroutineSize, this, traceMemory);
    else
       jumpDetector = NULL;
    // Open output file for writing
@@ -40,84 +56,51 @@ Aggregator::Aggregator(unsigned subroutineSize, std::string path) :
 
 /**
  * @brief Default destructor.
- * Destroys jump detector and all nodes in the graph.
+ * Destroys jump detector.
  */
 Aggregator::~Aggregator() {
    delete jumpDetector;
-   for (auto node : graph) {
-      delete node;
-   }
 }
 
 /**
- * @brief Adds new node into the graph if it does not exist yet.
- * First checks if current node (node that arrived last) has no such successor. If not, the
- * method creates new node with given call, pushes it to the end of vector containing graph
- * and creates necessary relations (updates successors and predecessors members of current node).
- * @param call Call to be stored in node.
+ * @brief Merges fragment created from a run into the graph.
+ * Walks the graph from its beginning by labels of the fragment, inserting the nodes that do not
+ * exist yet (see ::newNode). After the last call, the current node is set final.
+ * Result of merging is stored in the fragment (see RunFragment::nodeInserted).
+ * @param fragment Fragment to be merged.
  */
-void Aggregator::newNode(Call *call) {
-   unsigned newIndex;
-   if (graph[currentNode]->getSuccessors().empty() || !(newIndex = exists(call))) {
-      // If current node has no successor, or does not have same successor, create new one
-      GraphNode *newNode = new GraphNode(call);
-      // Insert new node into graph
-      graph.push_back(newNode);
-      newIndex = graph.size() - 1;
-      // Create relationships for new node
-      graph[currentNode]->addSuccessor(newIndex);
-      graph[newIndex]->setPredecessor(currentNode);
-      // Note node insertion
-      _nodeInserted = true;
-      insertedNodes.push_back(newIndex);
-      // Move to next node
-      currentNode = newIndex;
-      // Call jump detector to find potential jumps
-      if (jumpDetector != NULL)
-         jumpDetector->findJumps();
+void Aggregator::addRun(RunFragment *fragment) {
+   for (auto &label : fragment->getLabels()) {
+      newNode(symbols.intern(label));
    }
-   else
-      // If such node already exists, move to next node
-      currentNode = newIndex;
-}
-
-/**
- * @brief Tells aggregator a new run will begin with next call.
- * Sets current node final and resets certain members of the object.
- */
-void Aggregator::nextRun() {
-   graph[currentNode]->setFinal();
-   currentNode = 0;
-   _nodeInserted = false;
-   insertedNodes.clear();
-}
-
-/**
- * @brief Checks if node has been inserted in the run.
- * @return @a True if any node has been inserted, otherwise @a false.
- */
-bool Aggregator::nodeInserted() {
-   return _nodeInserted;
+   bool inserted = _nodeInserted;
+   nextRun();
+   fragment->setMerged(inserted);
 }
 
 /**
  * @brief Creates output from graph for program dot.
  * For every graph node, creates link to all its successors labeled by the successor call string.
+ * Nodes are numbered canonically (see ::canonicalOrder).
  */
 void Aggregator::drawGraph() {
+   std::vector<unsigned> order, ids;
+   canonicalOrder(order, ids);
+
    // Write graph header
    output << "digraph g {" << std::endl;
 
    output << "  0" << std::endl;
    // Write graph content
-   for (unsigned i = 0; i < graph.size(); ++i) {
+   for (unsigned i = 0; i < order.size(); ++i) {
       // Links to successors
-      for (auto succ : graph[i]->getSuccessors()) {
-         output << "  " << i << " -> " << succ << " [label=\"" << toString(graph[succ]->getCall())
+      for (auto succ : sortedSuccessors(order[i])) {
+         output << "  " << i << " -> " << ids[representative(succ)] << " [label=\""
+               << labelText(succ)
                << "\"]" << std::endl;
       }
       // Link to final state
-      if (graph[i]->isFinal())
+      if (graph.isFinal(order[i]))
          output << "  " << i << " -> " << "F" << " [label=\"&#949;\"]" << std::endl;
    }
 
@@ -128,13 +111,17 @@ void Aggregator::drawGraph() {
 /**
  * @brief Creates output from graph in JSON syntax.
  * Creates list of nodes and list of links between these nodes.
+ * Nodes are numbered canonically (see ::canonicalOrder).
  */
 void Aggregator::printJson() {
+   std::vector<unsigned> order, ids;
+   canonicalOrder(order, ids);
+
    // Start of JSON object
    output << "{" << std::endl;
    // Write nodes
    output << "  \"nodes\" : [" << std::endl;
-   for (unsigned i = 0; i < graph.size(); ++i) {
+   for (unsigned i = 0; i < order.size(); ++i) {
       output << "    {" << std::endl;
       output << "      \"id\" : " << i << "," << std::endl;
       output << "      \"label\" : \"" << i << "\"" << std::endl;
@@ -143,7 +130,7 @@ void Aggregator::printJson() {
       output << std::endl;
    }
    // Final node
-   int finalId = graph.size();
+   int finalId = order.size();
    output << "    {" << std::endl;
    output << "      \"id\" : " << finalId << "," << std::endl;
    output << "      \"label\" : \"F\"" << std::endl;
@@ -155,20 +142,21 @@ void Aggregator::printJson() {
    // Write edges
    output << "  \"links\" : [" << std::endl;
    bool isFirst = true;
-   for (unsigned i = 0; i < graph.size(); ++i) {
-      for (auto link : graph[i]->getSuccessors()) {
+   for (unsigned i = 0; i < order.size(); ++i) {
+      for (auto link : sortedSuccessors(order[i])) {
          if (!isFirst) {
             output << ",";
             output << std::endl;
          }
          output << "    {" << std::endl;
          output << "      \"source\" : " << i << "," << std::endl;
-         output << "      \"target\" : " << link << "," << std::endl;
-         output << "      \"label\" : \"" << toString(graph[link]->getCall()) << "\"" << std::endl;
+         output << "      \"target\" : " << ids[representative(link)] << "," << std::endl;
+         output << "      \"label\" : \"" << labelText(link) << "\""
+               << std::endl;
          output << "    }";
          isFirst = false;
       }
-      if (graph[i]->isFinal()){
+      if (graph.isFinal(order[i])){
          output << ",";
          output << std::endl;
          output << "    {" << std::endl;
@@ -184,60 +172,377 @@ void Aggregator::printJson() {
    output << "}" << std::endl;
 }
 
+/**
+ * @brief Minimizes the graph used in output.
+ * The graph is a deterministic automaton over labels of calls, where each node accepts the
+ * labels of the paths from it to final nodes. Nodes accepting same paths are merged in the
+ * output, so that common ends of runs (eg. error paths) are printed only once. Nodes are
+ * processed from the ends of runs towards the first node (Revuz's algorithm): two nodes are
+ * equivalent if both or none of them are final and their successors with same labels are
+ * equivalent. Nodes on cycles created by jumps are not merged. The graph itself is not
+ * changed, so aggregation must be finished before it is called.
+ */
+void Aggregator::minimize() {
+   graph.compact();
+   unsigned size = graph.getSize();
+   // Representatives are set when components are finished
+   classes.assign(size, 0);
+   // Successors of all nodes (successors of node i start at firsts[i])
+   std::vector<unsigned> firsts, targets, successors;
+   for (unsigned node = 0; node < size; ++node) {
+      firsts.push_back(targets.size());
+      graph.getSuccessors(node, successors);
+      targets.insert(targets.end(), successors.begin(), successors.end());
+   }
+   firsts.push_back(targets.size());
+
+   // Strongly connected components are found by Tarjan's algorithm (without recursion, graph may
+   // be deep), which finishes each component after all components reachable from it
+   std::vector<unsigned> indexes(size, size), lows(size, size), stack;
+   std::vector<bool> onStack(size, false);
+   std::vector<std::pair<unsigned, unsigned>> calls; // Node and position of its next successor
+   std::unordered_multimap<uint64_t, unsigned> registry; // Representatives by signature hash
+   std::vector<unsigned> signature, other;
+   unsigned counter = 0;
+   for (unsigned root = 0; root < size; ++root) {
+      if (indexes[root] != size)
+         continue;
+      calls.push_back(std::make_pair(root, firsts[root]));
+      indexes[root] = lows[root] = counter++;
+      stack.push_back(root);
+      onStack[root] = true;
+      while (!calls.empty()) {
+         unsigned node = calls.back().first;
+         unsigned edge = calls.back().second;
+         if (edge < firsts[node + 1]) {
+            // Visit next successor
+            ++calls.back().second;
+            unsigned succ = targets[edge];
+            if (indexes[succ] == size) {
+               calls.push_back(std::make_pair(succ, firsts[succ]));
+               indexes[succ] = lows[succ] = counter++;
+               stack.push_back(succ);
+               onStack[succ] = true;
+            }
+            else if (onStack[succ])
+               lows[node] = std::min(lows[node], indexes[succ]);
+            continue;
+         }
+         calls.pop_back();
+         if (!calls.empty()) {
+            unsigned parent = calls.back().first;
+            lows[parent] = std::min(lows[parent], lows[node]);
+         }
+         if (lows[node] != indexes[node])
+            continue;
+
+         // Node is the root of a component, nodes of the component are on the stack above it
+         bool cyclic = stack.back() != node
+               || std::find(targets.begin() + firsts[node], targets.begin() + firsts[node + 1],
+                     node) != targets.begin() + firsts[node + 1];
+         unsigned member;
+         do {
+            member = stack.back();
+            stack.pop_back();
+            onStack[member] = false;
+            classes[member] = member;
+         } while (member != node);
+         if (cyclic)
+            continue;
+
+         // Successors of the node already have their representatives, equivalent node is
+         // searched among registered nodes with same signature
+         getSignature(node, signature);
+         uint64_t hash = RollingHash::of(signature);
+         auto range = registry.equal_range(hash);
+         for (auto it = range.first; it != range.second; ++it) {
+            getSignature(it->second, other);
+            if (other == signature) {
+               classes[node] = it->second;
+               break;
+            }
+         }
+         if (classes[node] == node)
+            registry.insert(std::make_pair(hash, node));
+      }
+   }
+}
+
 /**
  * @brief Gets the number of nodes in graph.
  * @return Number of nodes.
  */
 unsigned Aggregator::nodesCount(){
-   return graph.size();
+   return graph.getSize();
+}
+
+/**
+ * @brief Creates text representation of the graph.
+ * Must be called between runs. The text contains the symbol table, all nodes of the graph and
+ * the state of jump detector, so that aggregation can continue after the graph is parsed.
+ * @return Text of the graph.
+ */
+std::string Aggregator::composeGraph() {
+   std::ostringstream msg;
+   // Labels are written in the order of their symbols, so the symbols do not change
+   msg << symbols.getSize();
+   for (unsigned i = 0; i < symbols.getSize(); ++i) {
+      const std::string &label = symbols.getLabel(i);
+      msg << " " << label.size() << ":" << label;
+   }
+   msg << " " << graph.getSize();
+   std::vector<unsigned> successors;
+   for (unsigned node = 0; node < graph.getSize(); ++node) {
+      graph.getSuccessors(node, successors);
+      msg << " " << graph.getLabel(node) << " " << graph.getPredecessor(node) << " "
+            << graph.isFinal(node) << " " << successors.size();
+      for (auto succ : successors) {
+         msg << " " << succ;
+      }
+   }
+   std::string jumps = jumpDetector != NULL ? jumpDetector->compose() : "";
+   msg << " " << jumps.size() << ":" << jumps;
+   return msg.str();
+}
+
+/**
+ * @brief Parses text representation of the graph.
+ * Nodes in the text replace the current graph.
+ * @param msg Text created by ::composeGraph.
+ * @throws ProtocolException In case the text is not a valid graph.
+ */
+void Aggregator::parseGraph(std::string msg) {
+   std::istringstream isMsg(msg);
+   size_t symbolsCnt;
+   if (!(isMsg >> symbolsCnt))
+      throw ProtocolException("Invalid graph");
+   symbols.clear();
+   texts.clear();
+   for (size_t i = 0; i < symbolsCnt; ++i) {
+      size_t labelSize;
+      if (!(isMsg >> labelSize) || isMsg.get() != ':')
+         throw ProtocolException("Invalid graph");
+      std::string label(labelSize, '\0');
+      if (labelSize > 0 && !isMsg.read(&label[0], labelSize))
+         throw ProtocolException("Invalid graph");
+      if (symbols.intern(label) != i)
+         throw ProtocolException("Invalid graph");
+   }
+
+   size_t size;
+   if (!(isMsg >> size) || size == 0)
+      throw ProtocolException("Invalid graph");
+   graph.clear();
+   for (size_t i = 0; i < size; ++i) {
+      unsigned label, predecessor, successorsCnt, succ;
+      bool final;
+      if (!(isMsg >> label >> predecessor >> final >> successorsCnt) || label >= symbolsCnt
+            || predecessor >= size)
+         throw ProtocolException("Invalid graph");
+      graph.addNode(label);
+      graph.setPredecessor(i, predecessor);
+      if (final)
+         graph.setFinal(i);
+      for (unsigned s = 0; s < successorsCnt; ++s) {
+         if (!(isMsg >> succ) || succ >= size)
+            throw ProtocolException("Invalid graph");
+         graph.addSuccessor(i, succ);
+      }
+   }
+
+   size_t jumpsSize;
+   if (!(isMsg >> jumpsSize) || isMsg.get() != ':')
+      throw ProtocolException("Invalid graph");
+   std::string jumps(jumpsSize, '\0');
+   if (jumpsSize > 0 && !isMsg.read(&jumps[0], jumpsSize))
+      throw ProtocolException("Invalid graph");
+   if (jumpDetector != NULL)
+      jumpDetector->parse(jumps);
+
+   // Successors are indexed after all nodes (and their labels) are known
+   successorMap.clear();
+   std::vector<unsigned> successors;
+   for (unsigned i = 0; i < graph.getSize(); ++i) {
+      graph.getSuccessors(i, successors);
+      for (auto succ : successors) {
+         successorMap.insert(i, graph.getLabel(succ), succ);
+      }
+   }
+   currentNode = 0;
+}
+
+/**
+ * @brief Adds new node into the graph if it does not exist yet.
+ * First checks if current node (node that arrived last) has no such successor. If not, the
+ * method creates new node with given label at the end of the graph and creates necessary relations (updates successors and predecessors members of current node).
+ * @param label Symbol of the label of the call to be stored in node.
+ */
+void Aggregator::newNode(unsigned label) {
+   unsigned newIndex;
+   if (!(newIndex = exists(label))) {
+      // If current node has no successor, or does not have same successor, create new one
+      newIndex = graph.addNode(label);
+      // Create relationships for new node
+      addSuccessor(currentNode, newIndex);
+      graph.setPredecessor(newIndex, currentNode);
+      // Note node insertion
+      _nodeInserted = true;
+      insertedNodes.push_back(newIndex);
+      // Move to next node
+      currentNode = newIndex;
+      // Call jump detector to find potential jumps
+      if (jumpDetector != NULL)
+         jumpDetector->findJumps();
+   }
+   else {
+      // If such node already exists, move to next node
+      currentNode = newIndex;
+      if (jumpDetector != NULL)
+         jumpDetector->moveTo(currentNode);
+   }
+}
+
+/**
+ * @brief Tells aggregator a new run will begin with next call.
+ * Sets current node final and resets certain members of the object.
+ */
+void Aggregator::nextRun() {
+   graph.setFinal(currentNode);
+   currentNode = 0;
+   if (jumpDetector != NULL)
+      jumpDetector->moveTo(currentNode);
+   _nodeInserted = false;
+   insertedNodes.clear();
+   // Nodes of the finished run are not needed in memory if the graph is large
+   graph.release();
 }
 
 /**
  * @brief Deletes last inserted node from graph.
+ * The node is also removed from successors of its predecessor in ::successorMap (but not from
+ * the successors of the predecessor in the graph).
  */
 void Aggregator::deleteLastNode() {
-   GraphNode *node = graph.back();
-   graph.pop_back();
-   delete node;
+   unsigned node = graph.getSize() - 1;
+   successorMap.erase(graph.getPredecessor(node), graph.getLabel(node), node);
+   graph.deleteLastNode();
+}
+
+/**
+ * @brief Adds successor of the node into graph.
+ * @param node Index of the node.
+ * @param successor Index of the successor.
+ */
+void Aggregator::addSuccessor(unsigned node, unsigned successor) {
+   graph.addSuccessor(node, successor);
+   successorMap.insert(node, graph.getLabel(successor), successor);
 }
 
 /**
  * @brief Checks whether call exists in graph.
- * Searches all successors of current call and compares them to the call given.
- * @param call Call to compare with.
+ * Finds successor of current call with the label given in ::successorMap.
+ * @param label Symbol of the label of the call to compare with.
  * @return If such call exists, returns its node index, otherwise return 0.
  */
-unsigned Aggregator::exists(Call *call) {
-   for (auto succ : graph[currentNode]->getSuccessors()) {
-      if (toString(graph[succ]->getCall()) == toString(call))
-         return succ;
-   }
-   return 0;
+unsigned Aggregator::exists(unsigned label) {
+   return successorMap.find(currentNode, label);
+}
+
+/**
+ * @brief Gets successors of the node sorted by their labels.
+ * Successors with same label keep the order in which they were inserted.
+ * @param index Index of the node in graph.
+ * @return Vector of successors indexes in graph.
+ */
+std::vector<unsigned> Aggregator::sortedSuccessors(unsigned index) {
+   std::vector<unsigned> successors;
+   graph.getSuccessors(index, successors);
+   std::stable_sort(successors.begin(), successors.end(), [this](unsigned a, unsigned b) {
+      return labelText(a) < labelText(b);
+   });
+   return successors;
+}
+
+/**
+ * @brief Gets text of the label of the node.
+ * Texts of all symbols are created when a text is needed for the first time (see ::getText).
+ * @param node Index of the node in graph.
+ * @return Text of the label.
+ */
+const std::string &Aggregator::labelText(unsigned node) {
+   // Texts of all symbols are created at once, so that returned references stay valid
+   while (texts.size() < symbols.getSize())
+      texts.push_back(getText(symbols.getLabel(texts.size())));
+   return texts[graph.getLabel(node)];
 }
 
 /**
- * @brief Converts call into its string representation.
- * This method is used to decide which calls are same and which are not.
- * Different aggregator types use different abstraction for creating this strings.
- * Basic aggregator uses only call function name as output stirng.
- * When creating new Aggregator type inherited from this class, this method must be redefined.
- * @param call Call to be converted.
- * @return String representation of the call.
+ * @brief Gets the node representing the node in output.
+ * @param node Index of the node in graph.
+ * @return Index of the representative of the node in graph (see ::minimize).
  */
-std::string Aggregator::toString(Call *call) {
-   return call->getName();
+unsigned Aggregator::representative(unsigned node) {
+   return classes.empty() ? node : classes[node];
 }
 
 /**
- * @brief Converts trace into its string representation.
- * @param trace Trace to be converted.
- * @return String representation of the trace.
+ * @brief Creates signature of the node used in minimization.
+ * Contains final flag of the node and label and representative of each successor.
+ * @param node Index of the node in graph.
+ * @param signature Vector filled with the signature.
  */
-std::string Aggregator::toString(Trace *trace) {
-   std::string result;
-   for (auto call : trace->getCalls()) {
-      result += toString(call);
-      result += ";";
+void Aggregator::getSignature(unsigned node, std::vector<unsigned> &signature) {
+   std::vector<unsigned> successors;
+   graph.getSuccessors(node, successors);
+   std::vector<std::pair<unsigned, unsigned>> edges;
+   for (auto succ : successors) {
+      edges.push_back(std::make_pair(graph.getLabel(succ), representative(succ)));
    }
-   return result;
-}
\ No newline at end of file
+   std::sort(edges.begin(), edges.end());
+   signature.clear();
+   signature.push_back(graph.isFinal(node));
+   for (auto &edge : edges) {
+      signature.push_back(edge.first);
+      signature.push_back(edge.second);
+   }
+}
+
+/**
+ * @brief Computes canonical numbering of graph nodes used in output.
+ * Indexes of nodes in graph depend on the order in which runs were merged. Canonical numbers
+ * are assigned by breadth-first search from the first node visiting successors sorted by
+ * label, so the output does not depend on the order of runs. Only representatives of nodes
+ * are numbered (see ::minimize).
+ * @param order Vector filled with graph indexes of nodes in canonical order.
+ * @param ids Vector filled with canonical number of each node (indexed by graph index).
+ */
+void Aggregator::canonicalOrder(std::vector<unsigned> &order, std::vector<unsigned> &ids) {
+   // Successors of each node are read from a contiguous block of edges
+   graph.compact();
+   unsigned size = graph.getSize();
+   order.clear();
+   ids.assign(size, size);
+   std::deque<unsigned> queue;
+   for (unsigned start = 0; start < size; ++start) {
+      // All nodes are reachable from the first one, other starts are only a safeguard
+      unsigned node = representative(start);
+      if (ids[node] != size)
+         continue;
+      ids[node] = order.size();
+      order.push_back(node);
+      queue.push_back(node);
+      while (!queue.empty()) {
+         node = queue.front();
+         queue.pop_front();
+         for (auto succ : sortedSuccessors(node)) {
+            // Successor not visited yet
+            succ = representative(succ);
+            if (ids[succ] == size) {
+               ids[succ] = order.size();
+               order.push_back(succ);
+               queue.push_back(succ);
+            }
+         }
+      }
+   }
+}
@@ -16,9 +16,11 @@
 #ifndef AGGREGATOR_H_
 #define AGGREGATOR_H_
 
-#include "Aggregator/GraphNode.h"
+#include "Aggregator/Graph.h"
+#include "Aggregator/RunFragment.h"
+#include "Aggregator/SymbolTable.h"
+#include "Aggregator/SuccessorMap.h"
 #include "Call.h"
-#include "Trace.h"
 #include "JumpDetector.h"
 
 #include <vector>
@@ -28,8 +30,11 @@
 /**
  * @brief Aggregates calls from different runs of tested program into one graph.
  *
- * Every time a message with call arrives from tested program, aggregator is called and checks
- * whether such call has already arrived and in case not, it adds it into the graph.
+ * Every run of tested program is passed to aggregator as a fragment containing labels of its calls.
+ * For each call, aggregator checks whether such call has already arrived and in case not, it adds
+ * it into the graph.
+ * Labels are interned in a symbol table when the fragment is merged, nodes of the graph contain
+ * only symbols of their labels, so the graph is searched by comparing integers.
  * Also is able to represent graph in various formats for output.
  * The graph structure can be modified by object of JumpDetector class which is therefore set as
  * friend class.
@@ -41,89 +46,182 @@ public:
     * Creates the first empty node in the graph, which represents starting point of the program.
     * Also creates jumps detector with specified minimal subroutine size and opens output file.
     * @param subroutineSize Minimal subroutine size for jump detector.
+    * @param jumps Type of jump detector (window or automaton).
     * @param path Destination of the output file.
-    * @throws ConfigurationException if output file can not be opened.
+    * @param graphMemory Maximal size of the memory used by the graph in bytes (0 if not limited).
+    * @param graphDir Directory of files of the graph (used only if its memory is limited).
+    * @param traceMemory Maximal size of the memory used by traces of jump detector in bytes (0 if
+    * not limited).
+    * @throws ConfigurationException if output file or files of the graph can not be opened.
     */
-   Aggregator(unsigned subroutineSize, std::string path);
+   Aggregator(unsigned subroutineSize, std::string jumps, std::string path, size_t graphMemory,
+         std::string graphDir, size_t traceMemory);
    /**
     * @brief Default destructor.
-    * Destroys jump detector and all nodes in the graph.
+    * Destroys jump detector.
     */
    virtual ~Aggregator();
 
    /**
-    * @brief Adds new node into the graph if it does not exist yet.
-    * First checks if current node (node that arrived last) has no such successor. If not, the
-    * method creates new node with given call, pushes it to the end of vector containing graph
-    * and creates necessary relations (updates successors and predecessors members of current node).
-    * @param call Call to be stored in node.
+    * @brief Merges fragment created from a run into the graph.
+    * Walks the graph from its beginning by labels of the fragment, inserting the nodes that do not
+    * exist yet (see ::newNode). After the last call, the current node is set final.
+    * Result of merging is stored in the fragment (see RunFragment::nodeInserted).
+    * @param fragment Fragment to be merged.
     */
-   void newNode(Call *call);
+   void addRun(RunFragment *fragment);
    /**
-    * @brief Tells aggregator a new run will begin with next call.
-    * Sets current node final and resets certain members of the object.
+    * @brief Converts calls of the run into their string representations (labels).
+    * This method is used to decide which calls are same and which are not.
+    * Different aggregator types use different abstraction for creating this strings, they are
+    * instances of LabelAggregator with different label policies.
+    * Method must not modify the aggregator, because it is called from worker threads.
+    * @param run Run with calls to be converted.
+    * @param labels Vector filled with labels of the calls (in the order of the calls).
     */
-   void nextRun();
+   virtual void getLabels(Run *run, std::vector<std::string> &labels) = 0;
    /**
-    * @brief Checks if node has been inserted in the run.
-    * @return @a True if any node has been inserted, otherwise @a false.
+    * @brief Converts label to text used in output.
+    * Labels may be binary keys (see BaseParamLabel), so they are converted only when the graph
+    * is printed.
+    * @param label Label created by ::getLabels.
+    * @return Text of the label.
     */
-   bool nodeInserted();
+   virtual std::string getText(const std::string &label) = 0;
 
    /**
     * @brief Creates output from graph for program dot.
     * For every graph node, creates link to all its successors labeled by the successor call string.
+    * Nodes are numbered canonically (see ::canonicalOrder).
     */
    void drawGraph();
    /**
     * @brief Creates output from graph in JSON syntax.
     * Creates list of nodes and list of links between these nodes.
+    * Nodes are numbered canonically (see ::canonicalOrder).
     */
    void printJson();
+   /**
+    * @brief Minimizes the graph used in output.
+    * The graph is a deterministic automaton over labels of calls, where each node accepts the
+    * labels of the paths from it to final nodes. Nodes accepting same paths are merged in the
+    * output, so that common ends of runs (eg. error paths) are printed only once. Nodes are
+    * processed from the ends of runs towards the first node (Revuz's algorithm): two nodes are
+    * equivalent if both or none of them are final and their successors with same labels are
+    * equivalent. Nodes on cycles created by jumps are not merged. The graph itself is not
+    * changed, so aggregation must be finished before it is called.
+    */
+   void minimize();
    /**
     * @brief Gets the number of nodes in graph.
     * @return Number of nodes.
     */
    unsigned nodesCount();
+   /**
+    * @brief Creates text representation of the graph.
+    * Must be called between runs. The text contains the symbol table, all nodes of the graph and
+    * the state of jump detector, so that aggregation can continue after the graph is parsed.
+    * @return Text of the graph.
+    */
+   std::string composeGraph();
+   /**
+    * @brief Parses text representation of the graph.
+    * Nodes in the text replace the current graph.
+    * @param msg Text created by ::composeGraph.
+    * @throws ProtocolException In case the text is not a valid graph.
+    */
+   void parseGraph(std::string msg);
 protected:
-   std::vector<GraphNode *> graph; /**< Vector of graph nodes representing graph. */
+   Graph graph; /**< Nodes of the graph. */
+   SymbolTable symbols; /**< Labels of the nodes in graph. */
+   SuccessorMap successorMap; /**< Successors of the nodes in graph by their labels. */
    int currentNode; /**< Index of current node - node with call that arrived as last. */
    bool _nodeInserted; /**< Flag set when a node is inserted and cleared before every new run. */
    std::vector<unsigned> insertedNodes; /**< List of inserted nodes into the graph during run. */
    JumpDetector *jumpDetector; /**< Jump detector responsible for finding jumps in the graph. */
    std::ofstream output; /**< File to write the output into */
+   std::vector<unsigned> classes; /**< Node representing each node in output (empty if the graph
+                                   * has not been minimized) */
+   std::vector<std::string> texts; /**< Texts of the labels used in output (indexed by symbols,
+                                    * see ::labelText) */
 private:
+   /**
+    * @brief Adds new node into the graph if it does not exist yet.
+    * First checks if current node (node that arrived last) has no such successor. If not, the
+    * method creates new node with given label at the end of the graph and creates necessary relations (updates successors and predecessors members of current node).
+    * @param label Symbol of the label of the call to be stored in node.
+    */
+   void newNode(unsigned label);
+   /**
+    * @brief Tells aggregator a new run will begin with next call.
+    * Sets current node final and resets certain members of the object.
+    */
+   void nextRun();
    /**
     * @brief Deletes last inserted node from graph.
+    * The node is also removed from successors of its predecessor in ::successorMap (but not from
+    * the successors of the predecessor in the graph).
     */
    void deleteLastNode();
+   /**
+    * @brief Adds successor of the node into graph.
+    * @param node Index of the node.
+    * @param successor Index of the successor.
+    */
+   void addSuccessor(unsigned node, unsigned successor);
    /**
     * @brief Checks whether call exists in graph.
-    * Searches all successors of current call and compares them to the call given.
-    * @param call Call to compare with.
+    * Finds successor of current call with the label given in ::successorMap.
+    * @param label Symbol of the label of the call to compare with.
     * @return If such call exists, returns its node index, otherwise return 0.
     */
-   unsigned exists(Call *call);
+   unsigned exists(unsigned label);
    /**
-    * @brief Converts call into its string representation.
-    * This method is used to decide which calls are same and which are not.
-    * Different aggregator types use different abstraction for creating this strings.
-    * When creating new Aggregator type inherited from this class, this method must be redefined.
-    * @param call Call to be converted.
-    * @return String representation of the call.
+    * @brief Gets successors of the node sorted by their labels.
+    * Successors with same label keep the order in which they were inserted.
+    * @param index Index of the node in graph.
+    * @return Vector of successors indexes in graph.
     */
-   virtual std::string toString(Call *call);
+   std::vector<unsigned> sortedSuccessors(unsigned index);
    /**
-    * @brief Converts trace into its string representation.
-    * @param trace Trace to be converted.
-    * @return String representation of the trace.
+    * @brief Gets text of the label of the node.
+    * Texts of all symbols are created when a text is needed for the first time (see ::getText).
+    * @param node Index of the node in graph.
+    * @return Text of the label.
     */
-   std::string toString(Trace *trace);
+   const std::string &labelText(unsigned node);
+   /**
+    * @brief Gets the node representing the node in output.
+    * @param node Index of the node in graph.
+    * @return Index of the representative of the node in graph (see ::minimize).
+    */
+   unsigned representative(unsigned node);
+   /**
+    * @brief Creates signature of the node used in minimization.
+    * Contains final flag of the node and label and representative of each successor.
+    * @param node Index of the node in graph.
+    * @param signature Vector filled with the signature.
+    */
+   void getSignature(unsigned node, std::vector<unsigned> &signature);
+   /**
+    * @brief Computes canonical numbering of graph nodes used in output.
+    * Indexes of nodes in graph depend on the order in which runs were merged. Canonical numbers
+    * are assigned by breadth-first search from the first node visiting successors sorted by
+    * label, so the output does not depend on the order of runs. Only representatives of nodes
+    * are numbered (see ::minimize).
+    * @param order Vector filled with graph indexes of nodes in canonical order.
+    * @param ids Vector filled with canonical number of each node (indexed by graph index).
+    */
+   void canonicalOrder(std::vector<unsigned> &order, std::vector<unsigned> &ids);
 
    /**
     * JumpDetector is a friend class because it needs to manipulate the graph directly.
     */
    friend class JumpDetector;
+   /**
+    * AutomatonJumpDetector is a friend class because it needs to manipulate the graph directly.
+    */
+   friend class AutomatonJumpDetector;
 };
 
 #endif /* AGGREGATOR_H_ */
@@ -0,0 +1,95 @@
+/**
+ * @file AggregatorThread.cpp
+ *
+ * Contains implementation of methods of the class AggregatorThread.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/AggregatorThread.h"
+
+#include <chrono>
+
+/**
+ * Number of empty polls after which the waiting thread starts sleeping instead of yielding.
+ */
+static const unsigned SPIN_LIMIT = 1000;
+
+/**
+ * @brief Waits a moment before next poll.
+ * First ::SPIN_LIMIT polls only yield the processor, later polls sleep for a short time.
+ * @param polls Number of polls that have been done so far (incremented).
+ */
+static void backoff(unsigned &polls) {
+   if (polls++ < SPIN_LIMIT)
+      std::this_thread::yield();
+   else
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+}
+
+/**
+ * @brief Constructor with aggregator initialization.
+ * Starts the aggregation thread.
+ * @param a Aggregator used for aggregating calls.
+ */
+AggregatorThread::AggregatorThread(Aggregator *a) :
+      aggregator(a), queue(4096), pushed(0), processed(0), running(true) {
+   thread = std::thread(&AggregatorThread::run, this);
+}
+
+/**
+ * @brief Default destructor.
+ * Merges remaining fragments and stops the aggregation thread.
+ */
+AggregatorThread::~AggregatorThread() {
+   running.store(false, std::memory_order_release);
+   thread.join();
+}
+
+/**
+ * @brief Passes new fragment to the aggregation thread.
+ * @param fragment Fragment to be merged into the graph.
+ * @see Aggregator::addRun
+ */
+void AggregatorThread::addRun(RunFragment *fragment) {
+   queue.push(fragment);
+   ++pushed;
+}
+
+/**
+ * @brief Waits until all fragments passed to the thread have been merged.
+ * After return, the aggregator can be safely accessed from calling thread.
+ */
+void AggregatorThread::sync() {
+   unsigned polls = 0;
+   while (processed.load(std::memory_order_acquire) != pushed)
+      backoff(polls);
+}
+
+/**
+ * @brief Main function of the aggregation thread.
+ * Pops fragments from queue and passes them to aggregator until ::running is cleared and queue
+ * is empty.
+ */
+void AggregatorThread::run() {
+   RunFragment *fragment;
+   unsigned polls = 0;
+   while (true) {
+      if (queue.pop(fragment)) {
+         polls = 0;
+         aggregator->addRun(fragment);
+         processed.fetch_add(1, std::memory_order_release);
+      }
+      else if (!running.load(std::memory_order_acquire)) {
+         // Thread shall end, but fragments pushed before the end must be aggregated as well
+         if (queue.empty())
+            break;
+      }
+      else
+         backoff(polls);
+   }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file AggregatorThread.h
+ *
+ * @brief AggregatorThread class.
+ *
+ * Contains definition of class AggregatorThread, which runs the aggregation of calls into
+ * control-flow graph in its own thread.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef AGGREGATORTHREAD_H_
+#define AGGREGATORTHREAD_H_
+
+#include "Aggregator/Aggregator.h"
+#include "Aggregator/LockFreeQueue.h"
+#include "Aggregator/RunFragment.h"
+
+#include <atomic>
+#include <thread>
+
+/**
+ * @brief Runs the aggregator in a separate thread.
+ *
+ * Runs of tested program are not aggregated directly by the threads communicating with tested
+ * program. Instead, fragments created from the runs are pushed into a lock-free queue which is
+ * consumed by the aggregation thread, so the communication only schedules calls and sends
+ * responses. Fragments are merged into the graph in the order in which they were pushed.
+ * Information whether a node has been inserted is stored in each fragment after it is merged
+ * (see RunFragment::isMerged).
+ */
+class AggregatorThread {
+public:
+   /**
+    * @brief Constructor with aggregator initialization.
+    * Starts the aggregation thread.
+    * @param a Aggregator used for aggregating calls.
+    */
+   AggregatorThread(Aggregator *a);
+   /**
+    * @brief Default destructor.
+    * Merges remaining fragments and stops the aggregation thread.
+    */
+   virtual ~AggregatorThread();
+
+   /**
+    * @brief Passes new fragment to the aggregation thread.
+    * @param fragment Fragment to be merged into the graph.
+    * @see Aggregator::addRun
+    */
+   void addRun(RunFragment *fragment);
+   /**
+    * @brief Waits until all fragments passed to the thread have been merged.
+    * After return, the aggregator can be safely accessed from calling thread.
+    */
+   void sync();
+protected:
+   Aggregator *aggregator; /**< Aggregator used by the thread */
+   LockFreeQueue<RunFragment *> queue; /**< Queue of fragments to be merged */
+   unsigned long pushed; /**< Number of items pushed into queue (used by producer only) */
+   std::atomic<unsigned long> processed; /**< Number of items already aggregated */
+   std::atomic<bool> running; /**< Flag cleared when thread shall end */
+   std::thread thread; /**< Aggregation thread */
+private:
+   /**
+    * @brief Main function of the aggregation thread.
+    * Pops fragments from queue and passes them to aggregator until ::running is cleared and queue
+    * is empty.
+    */
+   void run();
+};
+
+#endif /* AGGREGATORTHREAD_H_ */
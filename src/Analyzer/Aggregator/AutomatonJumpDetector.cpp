@@ -0,0 +1,358 @@
+/**
+ * @file AutomatonJumpDetector.cpp
+ *
+ * Contains implementation of methods of the class AutomatonJumpDetector.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/AutomatonJumpDetector.h"
+#include "Aggregator.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <algorithm>
+#include <sstream>
+
+/**
+ * @brief Constructor creating automaton of the graph containing only the first node.
+ * @param s Minimal subroutine size.
+ * @param a Aggregator.
+ */
+AutomatonJumpDetector::AutomatonJumpDetector(int s, Aggregator *a) :
+      JumpDetector(s, a, 0) {
+   parse("");
+}
+
+/**
+ * @brief Default destructor.
+ */
+AutomatonJumpDetector::~AutomatonJumpDetector() {
+}
+
+/**
+ * @brief Finds jumps in the graph in aggregator and modifies it.
+ * Adds position of the inserted node into the automaton and if the longest repeated suffix of
+ * its string ends with enough nodes inserted in current run, replaces them by a jump to the
+ * earlier occurrence of the suffix.
+ */
+void AutomatonJumpDetector::findJumps() {
+   Graph &graph = aggregator->graph;
+   std::vector<unsigned> &inserted = aggregator->insertedNodes;
+   unsigned node = aggregator->currentNode;
+   unsigned predecessor = graph.getPredecessor(node);
+
+   // Positions of deleted nodes are forgotten, the inserted node is the last one
+   nodePositions.resize(node);
+   unsigned position = positionLabels.size();
+   unsigned label = graph.getLabel(node);
+   nodePositions.push_back(addPosition(label, nodePositions[predecessor], position, node));
+
+   // Each node inserted in current run has its match (the last one is the predecessor of the
+   // inserted node if it has been inserted), matching continues from the predecessor if it is
+   // the previous inserted node, as traces of JumpDetector consist of consecutive inserted nodes
+   if (inserted.size() == 1)
+      runPath.clear();
+   unsigned state = 0, length = 0;
+   if (inserted.size() > 1 && inserted[inserted.size() - 2] == predecessor) {
+      state = runPath.back().state;
+      length = runPath.back().length;
+      // Shorter strings of the state may have been moved to a clone since it was matched
+      while (links[state] != NONE && lengths[links[state]] >= length)
+         state = links[state];
+   }
+
+   // Extend the suffix by the label, strings whose first end is the new position have not
+   // occurred before
+   while (state != NONE && ends[transitions.find(state, label)] == position) {
+      state = links[state];
+      if (state != NONE)
+         length = lengths[state];
+   }
+   if (state == NONE) {
+      state = 0;
+      length = 0;
+   }
+   else {
+      state = transitions.find(state, label);
+      length++;
+   }
+
+   // The suffix must not overlap its first occurrence, which is the earliest one. If the state
+   // can not be shortened enough, a suffix link may lead to an earlier occurrence.
+   while (length > 0) {
+      unsigned distance = pathDistance(ends[state]);
+      if (distance >= length)
+         break;
+      if (lengths[links[state]] <= distance) {
+         length = distance;
+         break;
+      }
+      state = links[state];
+      length = lengths[state];
+   }
+   runIndexes.resize(positionLabels.size());
+   runIndexes[position] = runPath.size();
+   runPath.push_back({position, state, length});
+   if (length < minSize)
+      return;
+
+   // The earlier occurrence of the suffix must precede it and must still be in graph, otherwise
+   // the suffix of minimal subroutine size may be replaced (as JumpDetector would do)
+   while (!findOccurrence(position, ends[state], length)) {
+      if (length == minSize)
+         return;
+      while (lengths[links[state]] >= minSize)
+         state = links[state];
+      length = minSize;
+   }
+   unsigned end = ends[state];
+   unsigned destination = jumpDest.front();
+
+   // Delete the suffix from graph, its positions are replaced by the earlier occurrence
+   for (unsigned i = 0, occurrence = end; i < length; ++i) {
+      aliases[position] = occurrence;
+      position = parents[position];
+      occurrence = parents[occurrence];
+      aggregator->currentNode = graph.getPredecessor(aggregator->currentNode);
+      aggregator->deleteLastNode();
+      inserted.pop_back();
+      runPath.pop_back();
+   }
+   nodePositions.resize(graph.getSize());
+   // Delete successor that has been replaced by jump (it is always last successor because
+   // the suffix has been created in current run)
+   graph.deleteSuccessor(aggregator->currentNode);
+   // Create jump
+   aggregator->addSuccessor(aggregator->currentNode, destination);
+   // Set current node to the end of the earlier occurrence
+   aggregator->currentNode = getNode(end);
+}
+
+/**
+ * @brief Finds the earlier occurrence of the suffix of the position in graph.
+ * @param position Last position of the suffix.
+ * @param end Last position of the earlier occurrence.
+ * @param length Length of the suffix.
+ * @return @a true if the nodes of the occurrence are a path in graph starting at least minimal
+ * subroutine size nodes before the suffix, ::jumpDest and ::labels then contain the nodes and
+ * labels of the occurrence.
+ */
+bool AutomatonJumpDetector::findOccurrence(unsigned position, unsigned end, unsigned length) {
+   jumpDest.assign(length, 0);
+   labels.assign(length, 0);
+   for (unsigned i = length; i-- > 0;) {
+      jumpDest[i] = getNode(end);
+      labels[i] = positionLabels[end];
+      if (i > 0) {
+         position = parents[position];
+         end = parents[end];
+      }
+   }
+   return jumpDest.front() + minSize <= positionNodes[position] && isPath(jumpDest, labels);
+}
+
+/**
+ * @brief Does nothing, the detector does not depend on the current node.
+ * @param node Index of the new current node.
+ */
+void AutomatonJumpDetector::moveTo(unsigned node) {
+}
+
+/**
+ * @brief Creates text representation of the state of the detector.
+ * @return Text of the positions in form:
+ * @verbatim <count> (<label> <parent> <alias> <node>)*@endverbatim
+ */
+std::string AutomatonJumpDetector::compose() {
+   std::ostringstream msg;
+   // The first position (of the first node) is not stored
+   msg << positionLabels.size() - 1;
+   for (unsigned position = 1; position < positionLabels.size(); ++position) {
+      msg << " " << positionLabels[position] << " " << parents[position] << " "
+            << aliases[position] << " " << positionNodes[position];
+   }
+   return msg.str();
+}
+
+/**
+ * @brief Parses text representation of the state of the detector.
+ * Creates automaton of the positions in the text. If the text is empty, creates automaton of
+ * the graph in aggregator.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid state.
+ */
+void AutomatonJumpDetector::parse(std::string msg) {
+   Graph &graph = aggregator->graph;
+   lengths.clear();
+   links.clear();
+   ends.clear();
+   outLabels.clear();
+   transitions.clear();
+   positionLabels.clear();
+   parents.clear();
+   aliases.clear();
+   positionNodes.clear();
+   positionStates.clear();
+   // Initial state represents the first position (empty string of the first node)
+   newState(0, NONE, 0);
+   positionLabels.push_back(0);
+   parents.push_back(0);
+   aliases.push_back(0);
+   positionNodes.push_back(0);
+   positionStates.push_back(0);
+
+   if (msg.empty()) {
+      // Each node is a position, predecessor of each node precedes it in the graph
+      for (unsigned node = 1; node < graph.getSize(); ++node) {
+         addPosition(graph.getLabel(node), graph.getPredecessor(node), node, node);
+      }
+   }
+   else {
+      std::istringstream isMsg(msg);
+      unsigned count;
+      if (!(isMsg >> count))
+         throw ProtocolException("Invalid jump detector");
+      for (unsigned position = 1; position <= count; ++position) {
+         unsigned label, parent, alias, node;
+         if (!(isMsg >> label >> parent >> alias >> node))
+            throw ProtocolException("Invalid jump detector");
+         // Positions refer only to the previous ones
+         if (parent >= position || alias > position
+               || (alias == position && node >= graph.getSize()))
+            throw ProtocolException("Invalid jump detector");
+         addPosition(label, parent, alias, node);
+      }
+   }
+
+   // Nodes of the graph are at the positions which have not been replaced
+   nodePositions.assign(graph.getSize(), 0);
+   for (unsigned position = 1; position < positionLabels.size(); ++position) {
+      if (aliases[position] == position)
+         nodePositions[positionNodes[position]] = position;
+   }
+   runPath.clear();
+   runIndexes.assign(positionLabels.size(), 0);
+}
+
+/**
+ * @brief Adds new position into the automaton.
+ * @param label Symbol of the label of the position.
+ * @param parent Position of the predecessor.
+ * @param alias Position replacing the new one.
+ * @param node Node of the position.
+ * @return The new position.
+ */
+unsigned AutomatonJumpDetector::addPosition(unsigned label, unsigned parent, unsigned alias,
+      unsigned node) {
+   unsigned position = positionLabels.size();
+   positionLabels.push_back(label);
+   parents.push_back(parent);
+   aliases.push_back(alias);
+   positionNodes.push_back(node);
+
+   unsigned state = positionStates[parent];
+   unsigned next = transitions.find(state, label);
+   if (next != 0) {
+      // Whole string has already occurred (eg. at a position replaced by a jump)
+      if (lengths[next] != lengths[state] + 1) {
+         unsigned clone = cloneState(next, lengths[state] + 1);
+         for (; state != NONE && transitions.find(state, label) == next; state = links[state]) {
+            transitions.erase(state, label, next);
+            transitions.insert(state, label, clone);
+         }
+         next = clone;
+      }
+      positionStates.push_back(next);
+      return position;
+   }
+
+   unsigned current = newState(lengths[state] + 1, 0, position);
+   for (; state != NONE && transitions.find(state, label) == 0; state = links[state]) {
+      addTransition(state, label, current);
+   }
+   if (state != NONE) {
+      next = transitions.find(state, label);
+      if (lengths[next] == lengths[state] + 1)
+         links[current] = next;
+      else {
+         unsigned clone = cloneState(next, lengths[state] + 1);
+         for (; state != NONE && transitions.find(state, label) == next; state = links[state]) {
+            transitions.erase(state, label, next);
+            transitions.insert(state, label, clone);
+         }
+         links[current] = clone;
+      }
+   }
+   positionStates.push_back(current);
+   return position;
+}
+
+/**
+ * @brief Gets the node of the graph where the position is.
+ * @param position Position.
+ * @return Index of the node of the position or of the position replacing it.
+ */
+unsigned AutomatonJumpDetector::getNode(unsigned position) {
+   while (aliases[position] != position) {
+      position = aliases[position];
+   }
+   return positionNodes[position];
+}
+
+/**
+ * @brief Gets distance of the position from the end of the path of current run.
+ * @param position Position.
+ * @return Number of nodes on the path after the position or NONE if the position is not on
+ * the path.
+ */
+unsigned AutomatonJumpDetector::pathDistance(unsigned position) {
+   unsigned index = runIndexes[position];
+   if (index >= runPath.size() || runPath[index].position != position)
+      return NONE;
+   return runPath.size() - index;
+}
+
+/**
+ * @brief Creates new state without transitions.
+ * @param length Length of the longest string of the state.
+ * @param link Suffix link of the state.
+ * @param end Position where the strings of the state ended for the first time.
+ * @return The new state.
+ */
+unsigned AutomatonJumpDetector::newState(unsigned length, unsigned link, unsigned end) {
+   lengths.push_back(length);
+   links.push_back(link);
+   ends.push_back(end);
+   outLabels.push_back(std::vector<unsigned>());
+   return lengths.size() - 1;
+}
+
+/**
+ * @brief Creates copy of the state with shorter longest string.
+ * @param state State to be copied (its suffix link is set to the copy).
+ * @param length Length of the longest string of the copy.
+ * @return The copy of the state.
+ */
+unsigned AutomatonJumpDetector::cloneState(unsigned state, unsigned length) {
+   unsigned clone = newState(length, links[state], ends[state]);
+   for (auto label : outLabels[state]) {
+      addTransition(clone, label, transitions.find(state, label));
+   }
+   links[state] = clone;
+   return clone;
+}
+
+/**
+ * @brief Adds transition of the state.
+ * @param state Source state.
+ * @param label Symbol of the label of the transition.
+ * @param target Target state.
+ */
+void AutomatonJumpDetector::addTransition(unsigned state, unsigned label, unsigned target) {
+   transitions.insert(state, label, target);
+   outLabels[state].push_back(label);
+}
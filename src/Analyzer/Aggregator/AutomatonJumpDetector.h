@@ -0,0 +1,167 @@
+/**
+ * @file AutomatonJumpDetector.h
+ *
+ * @brief AutomatonJumpDetector class.
+ *
+ * Contains definition of the class AutomatonJumpDetector, which detects jumps in the
+ * control-flow graph using suffix automaton of the labels.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef AUTOMATONJUMPDETECTOR_H_
+#define AUTOMATONJUMPDETECTOR_H_
+
+#include "JumpDetector.h"
+#include "SuccessorMap.h"
+
+#include <vector>
+#include <string>
+
+/**
+ * @brief Jump detector finding the longest repeated trace.
+ *
+ * Used when option jumps is set to automaton. Each node inserted into the graph gets a position,
+ * which represents the string of labels on the path to the node from the first node (following
+ * predecessors). The detector keeps a suffix automaton of the strings of all positions, which is
+ * extended by each inserted node in amortized constant time. The string of the nodes inserted in
+ * current run is matched against the automaton: the detector keeps the longest suffix of it that
+ * has already occurred and does not overlap its first occurrence, and extends it by each inserted
+ * node (shortening it by suffix links when needed), so matching takes amortized constant time as
+ * well. Overlap is checked by depth of the first occurrence on the path of current run, an
+ * occurrence outside of the path never overlaps. If the suffix has at least minimal subroutine
+ * size, its nodes are replaced by a jump to the earlier occurrence. Unlike JumpDetector, loops
+ * longer than minimal subroutine size are collapsed as soon as their body repeats.
+ *
+ * Positions of the nodes replaced by a jump stay in the automaton, each of them becomes an alias
+ * of the corresponding position of the earlier occurrence. Traces crossing the jump are thus
+ * found as well (as JumpDetector changes traces of deleted nodes in its table).
+ */
+class AutomatonJumpDetector: public JumpDetector {
+public:
+   /**
+    * @brief Constructor creating automaton of the graph containing only the first node.
+    * @param s Minimal subroutine size.
+    * @param a Aggregator.
+    */
+   AutomatonJumpDetector(int s, Aggregator *a);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~AutomatonJumpDetector();
+   /**
+    * @brief Finds jumps in the graph in aggregator and modifies it.
+    * Adds position of the inserted node into the automaton and if the longest repeated suffix of
+    * its string ends with enough nodes inserted in current run, replaces them by a jump to the
+    * earlier occurrence of the suffix.
+    */
+   void findJumps();
+   /**
+    * @brief Does nothing, the detector does not depend on the current node.
+    * @param node Index of the new current node.
+    */
+   void moveTo(unsigned node);
+   /**
+    * @brief Creates text representation of the state of the detector.
+    * @return Text of the positions in form:
+    * @verbatim <count> (<label> <parent> <alias> <node>)*@endverbatim
+    */
+   std::string compose();
+   /**
+    * @brief Parses text representation of the state of the detector.
+    * Creates automaton of the positions in the text. If the text is empty, creates automaton of
+    * the graph in aggregator.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid state.
+    */
+   void parse(std::string msg);
+protected:
+   std::vector<unsigned> lengths; /**< Length of the longest string of each state */
+   std::vector<unsigned> links; /**< Suffix link of each state (NONE for the initial one) */
+   std::vector<unsigned> ends; /**< Position where strings of each state ended for the first
+                                * time */
+   std::vector<std::vector<unsigned>> outLabels; /**< Labels of transitions of each state */
+   SuccessorMap transitions; /**< Transitions of states by labels (state 0 is never a target) */
+
+   std::vector<unsigned> positionLabels; /**< Symbol of the label of each position */
+   std::vector<unsigned> parents; /**< Position of the predecessor of each position */
+   std::vector<unsigned> aliases; /**< Position replacing each position (itself if its node has
+                                   * not been replaced by a jump) */
+   std::vector<unsigned> positionNodes; /**< Node of each position when it was inserted */
+   std::vector<unsigned> positionStates; /**< State of the string of each position */
+
+   std::vector<unsigned> nodePositions; /**< Position of each node of the graph */
+
+   /**
+    * @brief Node on the path of current run with the suffix matched at it.
+    */
+   struct Match {
+      unsigned position; /**< Position of the node */
+      unsigned state; /**< State of the longest suffix which has occurred before without overlap */
+      unsigned length; /**< Length of the suffix */
+   };
+   std::vector<Match> runPath; /**< Nodes inserted in current run on the path to current node */
+   std::vector<unsigned> runIndexes; /**< Index in ::runPath of each position (valid only if
+                                      * the entry refers back to the position) */
+private:
+   /**
+    * @brief Adds new position into the automaton.
+    * @param label Symbol of the label of the position.
+    * @param parent Position of the predecessor.
+    * @param alias Position replacing the new one.
+    * @param node Node of the position.
+    * @return The new position.
+    */
+   unsigned addPosition(unsigned label, unsigned parent, unsigned alias, unsigned node);
+   /**
+    * @brief Finds the earlier occurrence of the suffix of the position in graph.
+    * @param position Last position of the suffix.
+    * @param end Last position of the earlier occurrence.
+    * @param length Length of the suffix.
+    * @return @a true if the nodes of the occurrence are a path in graph starting at least minimal
+    * subroutine size nodes before the suffix, ::jumpDest and ::labels then contain the nodes and
+    * labels of the occurrence.
+    */
+   bool findOccurrence(unsigned position, unsigned end, unsigned length);
+   /**
+    * @brief Gets the node of the graph where the position is.
+    * @param position Position.
+    * @return Index of the node of the position or of the position replacing it.
+    */
+   unsigned getNode(unsigned position);
+   /**
+    * @brief Gets distance of the position from the end of the path of current run.
+    * @param position Position.
+    * @return Number of nodes on the path after the position or NONE if the position is not on
+    * the path.
+    */
+   unsigned pathDistance(unsigned position);
+   /**
+    * @brief Creates new state without transitions.
+    * @param length Length of the longest string of the state.
+    * @param link Suffix link of the state.
+    * @param end Position where the strings of the state ended for the first time.
+    * @return The new state.
+    */
+   unsigned newState(unsigned length, unsigned link, unsigned end);
+   /**
+    * @brief Creates copy of the state with shorter longest string.
+    * @param state State to be copied (its suffix link is set to the copy).
+    * @param length Length of the longest string of the copy.
+    * @return The copy of the state.
+    */
+   unsigned cloneState(unsigned state, unsigned length);
+   /**
+    * @brief Adds transition of the state.
+    * @param state Source state.
+    * @param label Symbol of the label of the transition.
+    * @param target Target state.
+    */
+   void addTransition(unsigned state, unsigned label, unsigned target);
+};
+
+#endif /* AUTOMATONJUMPDETECTOR_H_ */
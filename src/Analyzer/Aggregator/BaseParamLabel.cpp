@@ -0,0 +1,64 @@
+/**
+ * @file BaseParamLabel.cpp
+ *
+ * Contains the table of base parameters of the class BaseParamLabel.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/BaseParamLabel.h"
+
+/**
+ * Static table initialization (in the order of ::functions).
+ */
+const int BaseParamLabel::baseParams[SYNC + 1] = {
+      0, // READ
+      0, // WRITE
+      0, // OPEN
+      0, // OPEN64
+      0, // CLOSE
+      0, // LSEEK
+      0, // CREAT
+      0, // CREAT64
+      1, // LINK
+      1, // SYMLINK
+      0, // UNLINK
+      0, // STAT
+      0, // LSTAT
+      0, // FSTAT
+      0, // ACCESS
+      0, // CHMOD
+      0, // FCHMOD
+      0, // FLOCK
+      0, // OPENDIR
+      -1, // READDIR
+      -1, // CLOSEDIR
+      0, // MKDIR
+      0, // RMDIR
+      0, // FSYNC
+      1, // MMAP
+      1, // MUNMAP
+      1, // MLOCK
+      1, // MUNLOCK
+      0, // MLOCKALL
+      -1, // MUNLOCKALL
+      -1, // BRK
+      -1, // SELECT
+      -1, // POLL
+      0, // DUP
+      0, // DUP2
+      1, // SHMGET
+      0, // CHOWN
+      0, // FCHOWN
+      0, // LCHOWN
+      0, // MOUNT
+      0, // UMOUNT
+      0, // UMOUNT2
+      0, // UMASK
+      -1, // REWINDDIR
+      -1 // SYNC
+      };
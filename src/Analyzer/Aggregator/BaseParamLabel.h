@@ -0,0 +1,88 @@
+/**
+ * @file BaseParamLabel.h
+ *
+ * @brief BaseParamLabel class.
+ *
+ * Contains definition of the class BaseParamLabel, label policy aggregating calls by function
+ * name and base parameter value.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef BASEPARAMLABEL_H_
+#define BASEPARAMLABEL_H_
+
+#include "Call.h"
+#include "Param.h"
+
+#include <string>
+
+/**
+ * @brief Label policy distinguishing calls not only by function name, but also by base parameter
+ * value.
+ *
+ * Used by LabelAggregator for aggregator type base_param. Index of the base parameter of each
+ * function is stored in a table indexed by ::functions, so it is found without searching.
+ * The label is a binary key containing the typed value of the base parameter (see
+ * Param::appendKey), so calls are compared by numbers and path strings and nothing is formatted
+ * until the graph is printed (see ::text). The methods are defined here, so that they can be
+ * inlined.
+ */
+class BaseParamLabel {
+public:
+   /**
+    * @brief Appends label of the call.
+    * The label consists of function name, null byte, number of parameters, index of the base
+    * parameter (-1 if it is not used) and the key of the base parameter value (if the call has
+    * the parameter).
+    * @param call Call to be converted.
+    * @param result String the label is appended to.
+    */
+   static void label(Call call, std::string &result) {
+      result += call.getName();
+      result += '\0';
+      int base = baseParams[call.getFunction()];
+      int count = call.paramsCnt();
+      result += static_cast<char>(count);
+      result += static_cast<char>(base);
+      if (base >= 0 && base < count)
+         call.getParam(base).appendKey(result);
+   }
+   /**
+    * @brief Converts label to text used in output.
+    * The text is created from function name and base parameter value. Other parameters are not
+    * inserted (but commas between parameters are).
+    * @param label Label created by ::label.
+    * @return Text of the label.
+    */
+   static std::string text(const std::string &label) {
+      size_t nameEnd = label.find('\0');
+      std::string result = label.substr(0, nameEnd);
+      result += '(';
+      int count = static_cast<unsigned char>(label[nameEnd + 1]);
+      int base = static_cast<signed char>(label[nameEnd + 2]);
+      // Write parameters list, writing only base parameter value
+      if (base >= 0 && count > 0) {
+         if (base < count) {
+            result.append(base, ',');
+            result += Param::keyToString(label.data() + nameEnd + 3, label.size() - nameEnd - 3);
+            result.append(count - 1 - base, ',');
+         }
+         else
+            result.append(count - 1, ',');
+      }
+      result += ')';
+      return result;
+   }
+private:
+   /**
+    * Index of base parameter of each function (-1 if no parameter is considered base).
+    */
+   static const int baseParams[SYNC + 1];
+};
+
+#endif /* BASEPARAMLABEL_H_ */
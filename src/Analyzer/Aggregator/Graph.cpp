@@ -0,0 +1,287 @@
+/**
+ * @file Graph.cpp
+ *
+ * Contains implementation of methods of the class Graph.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/Graph.h"
+
+#include <algorithm>
+#include <unistd.h>
+
+const unsigned Graph::NONE;
+
+/**
+ * @brief Constructor creating graph without nodes.
+ * @param limit Maximal size of the memory used by the graph in bytes, 0 if the graph is kept
+ * in memory.
+ * @param directory Directory of files of the graph (used only if memory is limited).
+ * @throws ConfigurationException In case files of the graph can not be created.
+ */
+Graph::Graph(size_t limit, std::string directory) :
+      dir(limit > 0 ? directory : ""), memoryLimit(limit), labels(dir),
+      predecessors(dir), finals(dir), firstEdges(dir), lastEdges(dir), targets(dir),
+      nextEdges(dir), freeEdges(NONE) {
+}
+
+/**
+ * @brief Default destructor.
+ */
+Graph::~Graph() {
+}
+
+/**
+ * @brief Adds new node to the end of the graph.
+ * The node has no successors, its predecessor is the first node and it is not final.
+ * @param label Symbol of the label of the call represented by the node (see SymbolTable).
+ * @return Index of the node.
+ */
+unsigned Graph::addNode(unsigned label) {
+   labels.push_back(label);
+   predecessors.push_back(0);
+   finals.push_back(false);
+   firstEdges.push_back(NONE);
+   lastEdges.push_back(NONE);
+   return labels.size() - 1;
+}
+
+/**
+ * @brief Deletes the last node of the graph.
+ * Successors of the node are deleted too, the node is not removed from successors of other
+ * nodes.
+ */
+void Graph::deleteLastNode() {
+   // List of successors is prepended to the unused edges
+   if (firstEdges.back() != NONE) {
+      nextEdges[lastEdges.back()] = freeEdges;
+      freeEdges = firstEdges.back();
+   }
+   labels.pop_back();
+   predecessors.pop_back();
+   finals.pop_back();
+   firstEdges.pop_back();
+   lastEdges.pop_back();
+}
+
+/**
+ * @brief Deletes all nodes.
+ */
+void Graph::clear() {
+   labels.clear();
+   predecessors.clear();
+   finals.clear();
+   firstEdges.clear();
+   lastEdges.clear();
+   targets.clear();
+   nextEdges.clear();
+   freeEdges = NONE;
+}
+
+/**
+ * @brief Gets the number of nodes.
+ * @return Number of nodes.
+ */
+unsigned Graph::getSize() {
+   return labels.size();
+}
+
+/**
+ * @brief Gets the node label.
+ * @param node Index of the node.
+ * @return Symbol of the string representation of the call represented by the node.
+ */
+unsigned Graph::getLabel(unsigned node) {
+   return labels[node];
+}
+
+/**
+ * @brief Sets predecessor of the node.
+ * @param node Index of the node.
+ * @param p Index of predecessor in graph.
+ */
+void Graph::setPredecessor(unsigned node, unsigned p) {
+   predecessors[node] = p;
+}
+
+/**
+ * @brief Gets predecessor of the node.
+ * @param node Index of the node.
+ * @return Predecessor index in the graph.
+ */
+unsigned Graph::getPredecessor(unsigned node) {
+   return predecessors[node];
+}
+
+/**
+ * @brief Sets node to be final.
+ * @param node Index of the node.
+ */
+void Graph::setFinal(unsigned node) {
+   finals[node] = true;
+}
+
+/**
+ * @brief Checks if the node is final.
+ * @param node Index of the node.
+ * @return @a True if node is final, otherwise @a false.
+ */
+bool Graph::isFinal(unsigned node) {
+   return finals[node];
+}
+
+/**
+ * @brief Adds new successor of the node.
+ * @param node Index of the node.
+ * @param successor Index of the successor node.
+ */
+void Graph::addSuccessor(unsigned node, unsigned successor) {
+   unsigned edge = newEdge(successor);
+   if (firstEdges[node] == NONE)
+      firstEdges[node] = edge;
+   else
+      nextEdges[lastEdges[node]] = edge;
+   lastEdges[node] = edge;
+}
+
+/**
+ * @brief Deletes last successor of the node.
+ * If node has no successors, does nothing.
+ * @param node Index of the node.
+ */
+void Graph::deleteSuccessor(unsigned node) {
+   unsigned last = lastEdges[node];
+   if (last == NONE)
+      return;
+   if (firstEdges[node] == last) {
+      firstEdges[node] = NONE;
+      lastEdges[node] = NONE;
+   }
+   else {
+      // Lists are singly linked, the edge before the last one is found from the beginning
+      unsigned edge = firstEdges[node];
+      while (nextEdges[edge] != last)
+         edge = nextEdges[edge];
+      nextEdges[edge] = NONE;
+      lastEdges[node] = edge;
+   }
+   nextEdges[last] = freeEdges;
+   freeEdges = last;
+}
+
+/**
+ * @brief Gets all successors of the node.
+ * @param node Index of the node.
+ * @param successors Vector filled with successors indexes in graph (in the order in which they
+ * were added).
+ */
+void Graph::getSuccessors(unsigned node, std::vector<unsigned> &successors) {
+   successors.clear();
+   for (unsigned edge = firstEdges[node]; edge != NONE; edge = nextEdges[edge]) {
+      successors.push_back(targets[edge]);
+   }
+}
+
+/**
+ * @brief Compacts the pool of edges.
+ * Edges of each node are moved to a contiguous block, blocks are ordered by nodes and unused
+ * edges are released.
+ */
+void Graph::compact() {
+   MappedArray<unsigned> newTargets(dir);
+   MappedArray<unsigned> newNextEdges(dir);
+   for (unsigned node = 0; node < labels.size(); ++node) {
+      unsigned edge = firstEdges[node];
+      if (edge == NONE)
+         continue;
+      firstEdges[node] = newTargets.size();
+      for (; edge != NONE; edge = nextEdges[edge]) {
+         newTargets.push_back(targets[edge]);
+         newNextEdges.push_back(newTargets.size());
+      }
+      newNextEdges.back() = NONE;
+      lastEdges[node] = newTargets.size() - 1;
+   }
+   targets.swap(newTargets);
+   nextEdges.swap(newNextEdges);
+   freeEdges = NONE;
+}
+
+/**
+ * @brief Releases parts of the graph from memory if the graph exceeds memory limit.
+ * Must be called after each run, which starts new epoch of the arrays. When the pages used since
+ * their last release exceed the limit, the pages used last (by the last runs) are kept, so that
+ * they fill half of the limit, and older pages are released. Pages used by the last run are
+ * always kept.
+ */
+void Graph::release() {
+   if (memoryLimit == 0)
+      return;
+   if (getResidentBytes() > memoryLimit) {
+      std::vector<unsigned> epochs;
+      labels.getEpochs(epochs);
+      predecessors.getEpochs(epochs);
+      finals.getEpochs(epochs);
+      firstEdges.getEpochs(epochs);
+      lastEdges.getEpochs(epochs);
+      targets.getEpochs(epochs);
+      nextEdges.getEpochs(epochs);
+      // Epoch of the oldest page which fits into half of the limit
+      size_t kept = memoryLimit / 2 / sysconf(_SC_PAGESIZE);
+      if (kept < epochs.size()) {
+         unsigned newest = *std::max_element(epochs.begin(), epochs.end());
+         std::nth_element(epochs.begin(), epochs.end() - kept - 1, epochs.end());
+         unsigned oldest = std::min(epochs[epochs.size() - kept - 1] + 1, newest);
+         labels.releaseOlder(oldest);
+         predecessors.releaseOlder(oldest);
+         finals.releaseOlder(oldest);
+         firstEdges.releaseOlder(oldest);
+         lastEdges.releaseOlder(oldest);
+         targets.releaseOlder(oldest);
+         nextEdges.releaseOlder(oldest);
+      }
+   }
+   labels.nextEpoch();
+   predecessors.nextEpoch();
+   finals.nextEpoch();
+   firstEdges.nextEpoch();
+   lastEdges.nextEpoch();
+   targets.nextEpoch();
+   nextEdges.nextEpoch();
+}
+
+/**
+ * @brief Gets an edge from the pool.
+ * Unused edge is reused if there is some, otherwise the pool is enlarged.
+ * @param target Successor index of the edge.
+ * @return Index of the edge.
+ */
+unsigned Graph::newEdge(unsigned target) {
+   unsigned edge = freeEdges;
+   if (edge != NONE) {
+      freeEdges = nextEdges[edge];
+      targets[edge] = target;
+      nextEdges[edge] = NONE;
+   }
+   else {
+      edge = targets.size();
+      targets.push_back(target);
+      nextEdges.push_back(NONE);
+   }
+   return edge;
+}
+
+/**
+ * @brief Gets size of the memory used by the arrays since it was released last time.
+ * @return Number of bytes.
+ */
+size_t Graph::getResidentBytes() {
+   return labels.residentBytes() + predecessors.residentBytes() + finals.residentBytes()
+         + firstEdges.residentBytes() + lastEdges.residentBytes() + targets.residentBytes()
+         + nextEdges.residentBytes();
+}
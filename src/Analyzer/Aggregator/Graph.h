@@ -0,0 +1,176 @@
+/**
+ * @file Graph.h
+ *
+ * @brief Graph class.
+ *
+ * Contains definition of the class Graph which stores nodes of control-flow graph of the tested
+ * program.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef GRAPH_H_
+#define GRAPH_H_
+
+#include "Aggregator/MappedArray.h"
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Nodes of control-flow graph.
+ *
+ * Each node has a label, one predecessor, a final flag and multiple successors. Nodes are
+ * identified by their indexes and they are not separate objects: each attribute is stored in its
+ * own array indexed by the node, so a node takes only a few bytes and walking the graph reads
+ * contiguous memory.
+ *
+ * Successors are stored in a pool of edges shared by all nodes. Edges of a node form a list in
+ * the pool (in the order in which they were added), edges of deleted nodes and deleted successors
+ * are reused. The pool can be compacted, so that edges of each node are stored contiguously and
+ * nodes follow each other in the pool (as in compressed sparse row format).
+ *
+ * The arrays are kept in memory, unless a memory limit is given. Then each array is stored in
+ * a temporary file mapped into memory, so the graph may be larger than memory. The arrays record
+ * in which run each of their pages was used last (eg. by nodes on the path of the run). When
+ * the pages used since their last release exceed the limit, the pages not used by the last runs
+ * are released from memory (see ::release), so only the parts of the graph used recently stay in
+ * memory. Released parts are read from the files when they are accessed again.
+ */
+class Graph {
+public:
+   /**
+    * @brief Constructor creating graph without nodes.
+    * @param limit Maximal size of the memory used by the graph in bytes, 0 if the graph is kept
+    * in memory.
+    * @param directory Directory of files of the graph (used only if memory is limited).
+    * @throws ConfigurationException In case files of the graph can not be created.
+    */
+   Graph(size_t limit, std::string directory);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~Graph();
+
+   /**
+    * @brief Adds new node to the end of the graph.
+    * The node has no successors, its predecessor is the first node and it is not final.
+    * @param label Symbol of the label of the call represented by the node (see SymbolTable).
+    * @return Index of the node.
+    */
+   unsigned addNode(unsigned label);
+   /**
+    * @brief Deletes the last node of the graph.
+    * Successors of the node are deleted too, the node is not removed from successors of other
+    * nodes.
+    */
+   void deleteLastNode();
+   /**
+    * @brief Deletes all nodes.
+    */
+   void clear();
+   /**
+    * @brief Gets the number of nodes.
+    * @return Number of nodes.
+    */
+   unsigned getSize();
+
+   /**
+    * @brief Gets the node label.
+    * @param node Index of the node.
+    * @return Symbol of the string representation of the call represented by the node.
+    */
+   unsigned getLabel(unsigned node);
+   /**
+    * @brief Sets predecessor of the node.
+    * @param node Index of the node.
+    * @param p Index of predecessor in graph.
+    */
+   void setPredecessor(unsigned node, unsigned p);
+   /**
+    * @brief Gets predecessor of the node.
+    * @param node Index of the node.
+    * @return Predecessor index in the graph.
+    */
+   unsigned getPredecessor(unsigned node);
+   /**
+    * @brief Sets node to be final.
+    * @param node Index of the node.
+    */
+   void setFinal(unsigned node);
+   /**
+    * @brief Checks if the node is final.
+    * @param node Index of the node.
+    * @return @a True if node is final, otherwise @a false.
+    */
+   bool isFinal(unsigned node);
+
+   /**
+    * @brief Adds new successor of the node.
+    * @param node Index of the node.
+    * @param successor Index of the successor node.
+    */
+   void addSuccessor(unsigned node, unsigned successor);
+   /**
+    * @brief Deletes last successor of the node.
+    * If node has no successors, does nothing.
+    * @param node Index of the node.
+    */
+   void deleteSuccessor(unsigned node);
+   /**
+    * @brief Gets all successors of the node.
+    * @param node Index of the node.
+    * @param successors Vector filled with successors indexes in graph (in the order in which they
+    * were added).
+    */
+   void getSuccessors(unsigned node, std::vector<unsigned> &successors);
+   /**
+    * @brief Compacts the pool of edges.
+    * Edges of each node are moved to a contiguous block, blocks are ordered by nodes and unused
+    * edges are released.
+    */
+   void compact();
+   /**
+    * @brief Releases parts of the graph from memory if the graph exceeds memory limit.
+    * Must be called after each run, which starts new epoch of the arrays. When the pages used
+    * since their last release exceed the limit, the pages used last (by the last runs) are kept,
+    * so that they fill half of the limit, and older pages are released. Pages used by the last
+    * run are always kept.
+    */
+   void release();
+protected:
+   static const unsigned NONE = ~0U; /**< Index of edge terminating a list */
+
+   std::string dir; /**< Directory of the files of arrays, empty if they are kept in memory */
+   size_t memoryLimit; /**< Maximal size of the memory used by the arrays (0 if not limited) */
+
+   MappedArray<unsigned> labels; /**< Symbol of the label of each node */
+   MappedArray<unsigned> predecessors; /**< Predecessor index of each node */
+   MappedArray<bool> finals; /**< Flag if the node is final */
+   MappedArray<unsigned> firstEdges; /**< First edge of successors of each node */
+   MappedArray<unsigned> lastEdges; /**< Last edge of successors of each node */
+
+   MappedArray<unsigned> targets; /**< Successor index of each edge in the pool */
+   MappedArray<unsigned> nextEdges; /**< Next edge in the list of each edge in the pool */
+   unsigned freeEdges; /**< First edge of the list of unused edges */
+private:
+   /**
+    * @brief Gets an edge from the pool.
+    * Unused edge is reused if there is some, otherwise the pool is enlarged.
+    * @param target Successor index of the edge.
+    * @return Index of the edge.
+    */
+   unsigned newEdge(unsigned target);
+   /**
+    * @brief Gets size of the memory used by the arrays since it was released last time.
+    * @return Number of bytes.
+    */
+   size_t getResidentBytes();
+};
+
+#endif /* GRAPH_H_ */
@@ -11,15 +11,26 @@
  */
 
 #include "Aggregator/HashTable.h"
+#include "Aggregator/RollingHash.h"
+#include "Exceptions/ProtocolException.h"
 
 #include <algorithm>
+#include <cstring>
+#include <sstream>
 
 /**
- * @brief Default constructor.
- * Creates empty hashing table.
+ * Initial number of slots of the table.
  */
-HashTable::HashTable() :
-      table() {
+static const size_t INITIAL_SIZE = 64;
+
+/**
+ * @brief Constructor creating empty hashing table.
+ * @param w Number of nodes of each trace.
+ * @param limit Maximal size of the memory used by the table in bytes (0 if not limited).
+ */
+HashTable::HashTable(unsigned w, size_t limit) :
+      width(w), memoryLimit(limit), used(0), hashes(INITIAL_SIZE),
+      traces(INITIAL_SIZE * 2 * w, 0) {
 }
 
 /**
@@ -31,24 +42,24 @@ HashTable::~HashTable() {
 /**
  * @brief Finds the trace in table and if it is not there, inserts it.
  * Method can be used as insert into table if the return value is not handled.
- * @param traceStr String representing trace.
- * @param indexes Vector of indexes of the trace. Inserted to table if there has been no such
- * trace yet.
- * @return Found vector of indexes or empty vector in case new trace has been inserted.
+ * @param hash Hash of the labels of the trace.
+ * @param labels Symbols of the labels of nodes of the trace.
+ * @param indexes Indexes of the trace. Inserted to table if there has been no such trace yet.
+ * @return Found indexes (valid until a trace is inserted) or NULL in case new trace has been
+ * inserted.
  */
-std::vector<unsigned> HashTable::findTrace(std::string traceStr, std::vector<unsigned> indexes) {
+const unsigned *HashTable::findTrace(uint64_t hash, const std::vector<unsigned> &labels,
+      const std::vector<unsigned> &indexes) {
    // Search the trace in the table
-   auto iterator = table.find(traceStr);
-   if (iterator == table.end()) {
+   size_t slot = position(hash, labels.data());
+   if (isEmpty(slot)) {
       // If trace has not been found, insert it to the table
-      table[traceStr] = indexes;
-      // Return empty vector
-      std::vector<unsigned> result;
-      return result;
+      insert(slot, hash, labels.data(), indexes.data());
+      return NULL;
    }
    else {
-      // If trace already is in the table, return found indexes vector
-      return table[traceStr];
+      // If trace already is in the table, return found indexes
+      return &traces[(slot * 2 + 1) * width];
    }
 }
 
@@ -58,23 +69,161 @@ std::vector<unsigned> HashTable::findTrace(std::string traceStr, std::vector<uns
  * given, modifies vector of old indexes to new values.
  * Only last n values can be replaced, then ::startIndex marks the position in vector
  * where the replacement begins.
- * @param traceStr String representing trace.
+ * @param hash Hash of the labels of the trace.
+ * @param labels Symbols of the labels of nodes of the trace.
  * @param indexes Old indexes of the trace (for checking that found trace is really the one that
  * is needed to be modified.
  * @param startIndex Index of item in vector of indexes where the replacement begins.
  * @param newValues New indexes to be put into trace.
  */
-void HashTable::changeTrace(std::string traceStr, std::vector<unsigned> indexes,
-      unsigned startIndex, std::vector<unsigned> newValues) {
+void HashTable::changeTrace(uint64_t hash, const std::vector<unsigned> &labels,
+      const std::vector<unsigned> &indexes, unsigned startIndex,
+      const std::vector<unsigned> &newValues) {
    // Search the trace in the table
-   std::vector<unsigned> foundIndexes = table[traceStr];
+   size_t slot = position(hash, labels.data());
+   if (isEmpty(slot))
+      return;
+   unsigned *foundIndexes = &traces[(slot * 2 + 1) * width];
    // If the trace is the same one as the one found in table, replace indexes from position given
    // in startIndex by new values
-   if (std::equal(foundIndexes.begin(), foundIndexes.end(), indexes.begin())) {
+   if (std::equal(foundIndexes, foundIndexes + width, indexes.begin())) {
       unsigned j = 0;
-      for (unsigned i = startIndex; i < foundIndexes.size(); ++i) {
-         table[traceStr][i] = newValues[j++];
+      for (unsigned i = startIndex; i < width; ++i) {
+         foundIndexes[i] = newValues[j++];
+      }
+   }
+}
+
+/**
+ * @brief Creates text representation of the table.
+ * @return Text of the table in form:
+ * @verbatim <size> (<count> <labels> <count> <indexes>)*@endverbatim
+ */
+std::string HashTable::compose() {
+   std::ostringstream msg;
+   msg << used;
+   for (size_t slot = 0; slot < hashes.size(); ++slot) {
+      if (isEmpty(slot))
+         continue;
+      const unsigned *trace = &traces[slot * 2 * width];
+      msg << " " << width;
+      for (unsigned i = 0; i < width; ++i) {
+         msg << " " << trace[i];
+      }
+      msg << " " << width;
+      for (unsigned i = 0; i < width; ++i) {
+         msg << " " << trace[width + i];
       }
    }
+   return msg.str();
 }
 
+/**
+ * @brief Parses text representation of the table.
+ * Traces in the text replace the content of the table.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid table.
+ */
+void HashTable::parse(std::string msg) {
+   std::istringstream isMsg(msg);
+   size_t size;
+   if (!(isMsg >> size))
+      throw ProtocolException("Invalid hash table");
+   used = 0;
+   hashes.assign(INITIAL_SIZE, 0);
+   traces.assign(INITIAL_SIZE * 2 * width, 0);
+   std::vector<unsigned> labels(width), indexes(width);
+   for (size_t i = 0; i < size; ++i) {
+      size_t count;
+      if (!(isMsg >> count) || count != width)
+         throw ProtocolException("Invalid hash table");
+      for (auto &label : labels) {
+         if (!(isMsg >> label))
+            throw ProtocolException("Invalid hash table");
+      }
+      if (!(isMsg >> count) || count != width)
+         throw ProtocolException("Invalid hash table");
+      for (auto &index : indexes) {
+         if (!(isMsg >> index))
+            throw ProtocolException("Invalid hash table");
+      }
+      if (indexes[0] == 0)
+         throw ProtocolException("Invalid hash table");
+      // Hashes are not stored, they are computed from the labels
+      uint64_t hash = RollingHash::of(labels);
+      size_t slot = position(hash, labels.data());
+      if (isEmpty(slot))
+         insert(slot, hash, labels.data(), indexes.data());
+   }
+}
+
+/**
+ * @brief Finds slot of the trace.
+ * @param hash Hash of the labels of the trace.
+ * @param labels Symbols of the labels of nodes of the trace.
+ * @return Slot with the trace or empty slot where the search ended.
+ */
+size_t HashTable::position(uint64_t hash, const unsigned *labels) {
+   size_t mask = hashes.size() - 1;
+   // Polynomial hash has weak low bits, they are mixed with the high ones
+   uint64_t mixed = (hash ^ hash >> 33) * 0xFF51AFD7ED558CCDULL;
+   size_t slot = (mixed ^ mixed >> 33) & mask;
+   // Different traces with same hash are distinguished by their labels
+   while (!isEmpty(slot) && (hashes[slot] != hash
+         || memcmp(&traces[slot * 2 * width], labels, width * sizeof(unsigned)) != 0))
+      slot = (slot + 1) & mask;
+   return slot;
+}
+
+/**
+ * @brief Checks whether the slot is empty.
+ * @param slot Slot of the table.
+ * @return @a true if there is no trace in the slot.
+ */
+bool HashTable::isEmpty(size_t slot) {
+   return traces[(slot * 2 + 1) * width] == 0;
+}
+
+/**
+ * @brief Inserts trace into the empty slot, the table is enlarged if it is possible.
+ * @param slot Empty slot found by ::position.
+ * @param hash Hash of the labels of the trace.
+ * @param labels Symbols of the labels of nodes of the trace.
+ * @param indexes Indexes of the trace.
+ */
+void HashTable::insert(size_t slot, uint64_t hash, const unsigned *labels,
+      const unsigned *indexes) {
+   size_t slotSize = sizeof(uint64_t) + 2 * width * sizeof(unsigned);
+   if (2 * (used + 1) > hashes.size()) {
+      if (memoryLimit == 0 || 2 * hashes.size() * slotSize <= memoryLimit) {
+         grow();
+         slot = position(hash, labels);
+      }
+      else if (4 * (used + 1) > 3 * hashes.size())
+         // Table is full, the trace is not inserted
+         return;
+   }
+   hashes[slot] = hash;
+   std::copy(labels, labels + width, &traces[slot * 2 * width]);
+   std::copy(indexes, indexes + width, &traces[(slot * 2 + 1) * width]);
+   ++used;
+}
+
+/**
+ * @brief Doubles the table.
+ */
+void HashTable::grow() {
+   std::vector<uint64_t> oldHashes(hashes.size() * 2, 0);
+   std::vector<unsigned> oldTraces(traces.size() * 2, 0);
+   // Old table is swapped with the new empty one
+   oldHashes.swap(hashes);
+   oldTraces.swap(traces);
+   for (size_t slot = 0; slot < oldHashes.size(); ++slot) {
+      const unsigned *trace = &oldTraces[slot * 2 * width];
+      if (trace[width] == 0)
+         continue;
+      size_t newSlot = position(oldHashes[slot], trace);
+      hashes[newSlot] = oldHashes[slot];
+      std::copy(trace, trace + 2 * width, &traces[newSlot * 2 * width]);
+   }
+}
@@ -15,9 +15,10 @@
 #ifndef HASHTABLE_H_
 #define HASHTABLE_H_
 
-#include <unordered_map>
 #include <vector>
 #include <string>
+#include <cstdint>
+#include <cstddef>
 
 /**
  * @brief Hash table for traces.
@@ -26,14 +27,23 @@
  * The table serves for mapping trace into vector of indexes in graph the trace lies on.
  * Used during jump detection for finding if given trace has already been present in the tested
  * program and might be considered a subroutine.
+ * Traces are given by labels of their nodes together with the hash of the labels (see
+ * RollingHash), the labels are compared only when hashes are same.
+ *
+ * All traces have same size (minimal subroutine size), so the table uses open addressing with
+ * linear probing and stores labels and indexes of each trace inline in one array, without
+ * allocating memory for each trace. Traces are never removed. The table doubles when it is half
+ * full, unless it would exceed the memory limit; then it is filled up to three quarters and
+ * further traces are not inserted (so jumps to them are not detected).
  */
 class HashTable {
 public:
    /**
-    * @brief Default constructor.
-    * Creates empty hashing table.
+    * @brief Constructor creating empty hashing table.
+    * @param w Number of nodes of each trace.
+    * @param limit Maximal size of the memory used by the table in bytes (0 if not limited).
     */
-   HashTable();
+   HashTable(unsigned w, size_t limit);
    /**
     * @brief Default destructor.
     */
@@ -42,32 +52,76 @@ public:
    /**
     * @brief Finds the trace in table and if it is not there, inserts it.
     * Method can be used as insert into table if the return value is not handled.
-    * @param traceStr String representing trace.
-    * @param indexes Vector of indexes of the trace. Inserted to table if there has been no such
-    * trace yet.
-    * @return Found vector of indexes or empty vector in case new trace has been inserted.
+    * @param hash Hash of the labels of the trace.
+    * @param labels Symbols of the labels of nodes of the trace.
+    * @param indexes Indexes of the trace. Inserted to table if there has been no such trace yet.
+    * @return Found indexes (valid until a trace is inserted) or NULL in case new trace has been
+    * inserted.
     */
-   std::vector<unsigned> findTrace(std::string traceStr, std::vector<unsigned> indexes);
+   const unsigned *findTrace(uint64_t hash, const std::vector<unsigned> &labels,
+         const std::vector<unsigned> &indexes);
    /**
     * @brief Change the indexes of the trace.
     * Searches the trace in hashing table. If obtained indexes are same as the indexes of the trace
     * given, modifies vector of old indexes to new values.
     * Only last n values can be replaced, then ::startIndex marks the position in vector
     * where the replacement begins.
-    * @param traceStr String representing trace.
+    * @param hash Hash of the labels of the trace.
+    * @param labels Symbols of the labels of nodes of the trace.
     * @param indexes Old indexes of the trace (for checking that found trace is really the one that
     * is needed to be modified.
     * @param startIndex Index of item in vector of indexes where the replacement begins.
     * @param newValues New indexes to be put into trace.
     */
-   void changeTrace(std::string traceStr, std::vector<unsigned> indexes, unsigned startIndex,
-         std::vector<unsigned> newValues);
+   void changeTrace(uint64_t hash, const std::vector<unsigned> &labels,
+         const std::vector<unsigned> &indexes, unsigned startIndex,
+         const std::vector<unsigned> &newValues);
+   /**
+    * @brief Creates text representation of the table.
+    * @return Text of the table in form:
+    * @verbatim <size> (<count> <labels> <count> <indexes>)*@endverbatim
+    */
+   std::string compose();
+   /**
+    * @brief Parses text representation of the table.
+    * Traces in the text replace the content of the table.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid table.
+    */
+   void parse(std::string msg);
 protected:
+   unsigned width; /**< Number of nodes of each trace */
+   size_t memoryLimit; /**< Maximal size of the memory used by the table (0 if not limited) */
+   size_t used; /**< Number of traces in the table */
+   std::vector<uint64_t> hashes; /**< Hash of the trace in each slot, size is a power of 2 */
+   std::vector<unsigned> traces; /**< Labels followed by indexes of the trace in each slot, first
+                                  * index is 0 in empty slots (traces never start at node 0) */
+private:
+   /**
+    * @brief Finds slot of the trace.
+    * @param hash Hash of the labels of the trace.
+    * @param labels Symbols of the labels of nodes of the trace.
+    * @return Slot with the trace or empty slot where the search ended.
+    */
+   size_t position(uint64_t hash, const unsigned *labels);
+   /**
+    * @brief Checks whether the slot is empty.
+    * @param slot Slot of the table.
+    * @return @a true if there is no trace in the slot.
+    */
+   bool isEmpty(size_t slot);
+   /**
+    * @brief Inserts trace into the empty slot, the table is enlarged if it is possible.
+    * @param slot Empty slot found by ::position.
+    * @param hash Hash of the labels of the trace.
+    * @param labels Symbols of the labels of nodes of the trace.
+    * @param indexes Indexes of the trace.
+    */
+   void insert(size_t slot, uint64_t hash, const unsigned *labels, const unsigned *indexes);
    /**
-    * Hash table mapping traces (strings representing traces) into their position in the graph.
-    * The structure used is unordered_map from C++11 standard, which is implemented as hash table.
+    * @brief Doubles the table.
     */
-   std::unordered_map<std::string, std::vector<unsigned>> table;
+   void grow();
 };
 
 #endif /* HASHTABLE_H_ */
@@ -12,19 +12,23 @@
 
 #include "Aggregator/JumpDetector.h"
 #include "Aggregator.h"
-#include "Trace.h"
 
 #include <vector>
 #include <algorithm>
 
+const unsigned JumpDetector::NONE;
+
 /**
  * @brief Constructor with members initialization.
  * Sets minimal subroutine size and pointer to aggregator.
  * @param s Minimal subroutine size.
  * @param a Aggregator.
+ * @param tableMemory Maximal size of the memory used by the hash table in bytes (0 if not
+ * limited).
  */
-JumpDetector::JumpDetector(int s, Aggregator *a) :
-      minSize(s), aggregator(a), traceStr() {
+JumpDetector::JumpDetector(int s, Aggregator *a, size_t tableMemory) :
+      table(s, tableMemory), minSize(s), aggregator(a), window(s, 0), first(0),
+      windowNode(NONE), hash(s) {
 }
 
 /**
@@ -41,70 +45,150 @@ JumpDetector::~JumpDetector() {
  */
 void JumpDetector::findJumps() {
    // Find last trace of minimal subroutine size
-   getTrace(aggregator->currentNode);
+   moveTo(aggregator->currentNode);
+   getTrace();
    if (!indexes.empty()) {
       // Find trace in hash table
-      std::vector<unsigned> jumpDest = table.findTrace(traceStr, indexes);
-      if (!jumpDest.empty()) {
+      const unsigned *found = table.findTrace(hash.getValue(), labels, indexes);
+      if (found != NULL) {
          // Trace was found in the hash table, jumpDest contains indexes of found trace
+         jumpDest.assign(found, found + minSize);
 
-         // Last trace must be all created in current program run
-         if (std::equal(indexes.begin(), indexes.end(), aggregator->insertedNodes.end() - minSize)
-               && indexes.front() - jumpDest.front() >= minSize) {
+         // Last trace must be all created in current program run and must not overlap the
+         // found trace, which must still be in graph
+         std::vector<unsigned> &inserted = aggregator->insertedNodes;
+         if (inserted.size() >= minSize
+               && std::equal(indexes.begin(), indexes.end(), inserted.end() - minSize)
+               && jumpDest.front() + minSize <= indexes.front() && isPath(jumpDest, labels)) {
 
             // Delete the trace from graph and change corresponding traces in hash table
             for (unsigned i = 0; i < minSize; ++i) {
 
                // If a trace has been created when the node has been inserted, change the trace to
                // correspond with the new jump
-               getTrace(aggregator->currentNode);
+               getTrace();
                if (!indexes.empty())
-                  table.changeTrace(traceStr, indexes, i, jumpDest);
+                  table.changeTrace(hash.getValue(), labels, indexes, i, jumpDest);
 
                // Delete node from graph
                aggregator->currentNode =
-                     aggregator->graph[aggregator->currentNode]->getPredecessor();
+                     aggregator->graph.getPredecessor(aggregator->currentNode);
+               moveTo(aggregator->currentNode);
                aggregator->deleteLastNode();
                aggregator->insertedNodes.pop_back();
             }
             // Delete successor that has been replaced by jump (it is always last successor because
             // the trace has been created in current run)
-            aggregator->graph[aggregator->currentNode]->deleteSuccessor();
+            aggregator->graph.deleteSuccessor(aggregator->currentNode);
             // Create jump
-            aggregator->graph[aggregator->currentNode]->addSuccessor(jumpDest.front());
+            aggregator->addSuccessor(aggregator->currentNode, jumpDest.front());
             // Set current node to the end of destination trace
             aggregator->currentNode = jumpDest.back();
+            moveTo(aggregator->currentNode);
          }
       }
    }
 }
 
 /**
- * @brief Get the trace of size equal to minimal subroutine size ending at given index.
- * @param node Ending node of the trace requested.
+ * @brief Moves the window to the trace ending at given node.
+ * Must be called whenever the current node of aggregator changes.
+ * @param node Index of the new current node.
+ */
+void JumpDetector::moveTo(unsigned node) {
+   if (node == windowNode)
+      return;
+   Graph &graph = aggregator->graph;
+   if (windowNode != NONE && node != 0 && graph.getPredecessor(node) == windowNode) {
+      // Moving to successor, the first node leaves the window
+      hash.push(graph.getLabel(node), graph.getLabel(window[first]));
+      window[first] = node;
+      first = (first + 1) % minSize;
+   }
+   else if (windowNode != NONE && node == graph.getPredecessor(windowNode)) {
+      // Moving to predecessor, the last node leaves the window
+      unsigned last = (first + minSize - 1) % minSize;
+      unsigned front = graph.getPredecessor(window[first]);
+      hash.pushFront(graph.getLabel(front), graph.getLabel(window[last]));
+      window[last] = front;
+      first = last;
+   }
+   else
+      fillWindow(node);
+   windowNode = node;
+}
+
+/**
+ * @brief Creates text representation of the state of the detector.
+ * @return Text of the hash table with traces.
+ */
+std::string JumpDetector::compose() {
+   return table.compose();
+}
+
+/**
+ * @brief Parses text representation of the state of the detector.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid state.
+ */
+void JumpDetector::parse(std::string msg) {
+   table.parse(msg);
+   // Graph has been replaced, window is created again when it is needed
+   windowNode = NONE;
+}
+
+/**
+ * @brief Checks that the nodes are a path in the graph with given labels.
+ * Found trace may refer to nodes which have been deleted by a later jump (their indexes may
+ * have been reused), or its edges may have been deleted with them.
+ * @param nodes Indexes of the nodes (the first one must be in the graph).
+ * @param nodeLabels Labels of the nodes.
+ * @return @a true if each node has given label and is a successor of the previous one.
  */
-void JumpDetector::getTrace(unsigned startNode) {
+bool JumpDetector::isPath(const std::vector<unsigned> &nodes,
+      const std::vector<unsigned> &nodeLabels) {
+   if (aggregator->graph.getLabel(nodes.front()) != nodeLabels.front())
+      return false;
+   // Successors are indexed by their labels
+   for (unsigned i = 1; i < nodes.size(); ++i) {
+      if (aggregator->successorMap.find(nodes[i - 1], nodeLabels[i]) != nodes[i])
+         return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Gets the trace of size equal to minimal subroutine size ending at current node.
+ * Fills ::indexes and ::labels from the window, they are empty if the trace would start at
+ * node 0.
+ */
+void JumpDetector::getTrace() {
    indexes.clear();
-   unsigned nodeIndex = startNode;
-   // Array of indexes
-   unsigned path[minSize];
-   // Fill the array of indexes from back to front
+   labels.clear();
+   // Trace must contain correct number of nodes (must not start at node 0)
+   if (window[first] == 0)
+      return;
+   for (unsigned i = 0; i < minSize; ++i) {
+      unsigned node = window[(first + i) % minSize];
+      indexes.push_back(node);
+      labels.push_back(aggregator->graph.getLabel(node));
+   }
+}
+
+/**
+ * @brief Creates the window of the trace ending at given node from its predecessors.
+ * @param node Last node of the trace.
+ */
+void JumpDetector::fillWindow(unsigned node) {
+   Graph &graph = aggregator->graph;
+   first = 0;
+   // Fill the window from back to front
    for (int i = minSize - 1; i >= 0; --i) {
-      path[i] = nodeIndex;
-      nodeIndex = aggregator->graph[nodeIndex]->getPredecessor();
+      window[i] = node;
+      node = graph.getPredecessor(node);
    }
-   // Trace must contain correct number of nodes (must not start at node 0)
-   if (path[0] != 0) {
-      // Create vector from array of indexes and store it into object variable
-      for (unsigned i = 0; i < minSize; ++i) {
-         indexes.push_back(path[i]);
-      }
-      // Create trace from vector of indexes and store its string representation into object
-      // variable
-      Trace trace;
-      for (auto i : indexes) {
-         trace.nextCall(aggregator->graph[i]->getCall());
-      }
-      traceStr = aggregator->toString(&trace);
+   hash.clear();
+   for (auto n : window) {
+      hash.push(graph.getLabel(n), 0);
    }
 }
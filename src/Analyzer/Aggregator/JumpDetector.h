@@ -17,7 +17,9 @@
 #define JUMPDETECTOR_H_
 
 #include "HashTable.h"
+#include "RollingHash.h"
 
+#include <vector>
 #include <string>
 
 // Forward declaration of class Aggregator for the linker
@@ -28,6 +30,14 @@ class Aggregator;
  *
  * Searches jumps in control-flow graph and modifies it.
  * Can directly modify graph in Aggregator class because it is a friend class of Aggregator.
+ *
+ * The trace searched in the hash table consists of the current node of aggregator and its
+ * predecessors. Detector keeps the trace of the current node in a window together with the
+ * rolling hash of its labels. Aggregator tells the detector when the current node moves (see
+ * ::moveTo); when it moves to a successor or to the predecessor, the window and the hash are
+ * updated in constant time, otherwise (after jumps and at start of runs) the window is created
+ * again from the predecessors of the node.
+ * Other detectors (see AutomatonJumpDetector) reimplement methods of this class.
  */
 class JumpDetector {
 public:
@@ -36,8 +46,10 @@ public:
     * Sets minimal subroutine size and pointer to aggregator.
     * @param s Minimal subroutine size.
     * @param a Aggregator.
+    * @param tableMemory Maximal size of the memory used by the hash table in bytes (0 if not
+    * limited).
     */
-   JumpDetector(int s, Aggregator *a);
+   JumpDetector(int s, Aggregator *a, size_t tableMemory);
    /**
     * @brief Default destructor.
     */
@@ -48,20 +60,62 @@ public:
     * and if it has already been in the table, creates new link from trace beginning to found
     * trace beginning.
     */
-   void findJumps();
+   virtual void findJumps();
+   /**
+    * @brief Moves the window to the trace ending at given node.
+    * Must be called whenever the current node of aggregator changes.
+    * @param node Index of the new current node.
+    */
+   virtual void moveTo(unsigned node);
+   /**
+    * @brief Creates text representation of the state of the detector.
+    * @return Text of the hash table with traces.
+    */
+   virtual std::string compose();
+   /**
+    * @brief Parses text representation of the state of the detector.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid state.
+    */
+   virtual void parse(std::string msg);
 protected:
+   static const unsigned NONE = ~0U; /**< Value of ::windowNode when there is no window */
+
    HashTable table; /**< Hash table for saving and searching traces */
    unsigned minSize; /**< Minimal subroutine size */
    Aggregator *aggregator; /**< Aggregator containing graph to search jumps in */
 
-   std::string traceStr; /**< Auxiliary member used for trace string when searching traces in graph */
+   std::vector<unsigned> window; /**< Ring of indexes of nodes of the trace ending at
+                                  * ::windowNode (node 0 where the trace reaches the beginning) */
+   unsigned first; /**< Position of the first node of the trace in ::window */
+   unsigned windowNode; /**< Last node of the trace in ::window */
+   RollingHash hash; /**< Hash of labels of nodes in ::window */
+
+   std::vector<unsigned> labels; /**< Auxiliary member containing labels of found trace */
    std::vector<unsigned> indexes; /**< Auxiliary member containing indexes of found trace */
+   std::vector<unsigned> jumpDest; /**< Auxiliary member containing indexes of jump destination */
+
+   /**
+    * @brief Checks that the nodes are a path in the graph with given labels.
+    * Found trace may refer to nodes which have been deleted by a later jump (their indexes may
+    * have been reused), or its edges may have been deleted with them.
+    * @param nodes Indexes of the nodes (the first one must be in the graph).
+    * @param nodeLabels Labels of the nodes.
+    * @return @a true if each node has given label and is a successor of the previous one.
+    */
+   bool isPath(const std::vector<unsigned> &nodes, const std::vector<unsigned> &nodeLabels);
 private:
    /**
-    * @brief Get the trace of size equal to minimal subroutine size ending at given index.
-    * @param node Ending node of the trace requested.
+    * @brief Gets the trace of size equal to minimal subroutine size ending at current node.
+    * Fills ::indexes and ::labels from the window, they are empty if the trace would start at
+    * node 0.
+    */
+   void getTrace();
+   /**
+    * @brief Creates the window of the trace ending at given node from its predecessors.
+    * @param node Last node of the trace.
     */
-   void getTrace(unsigned node);
+   void fillWindow(unsigned node);
 };
 
 #endif /* JUMPDETECTOR_H_ */
@@ -0,0 +1,85 @@
+/**
+ * @file LabelAggregator.h
+ *
+ * @brief LabelAggregator class template.
+ *
+ * Contains definition of class template LabelAggregator, an aggregator computing labels of calls
+ * by a label policy given at compile time.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef LABELAGGREGATOR_H_
+#define LABELAGGREGATOR_H_
+
+#include "Aggregator/Aggregator.h"
+#include "Run.h"
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Aggregator using label policy to decide which calls are same.
+ *
+ * Policy is a class with static methods
+ * @verbatim static void label(Call call, std::string &result)
+static std::string text(const std::string &label) @endverbatim
+ * appending label of the call to the string and converting the label to text used in output
+ * (see NameLabel, BaseParamLabel, ReturnLabel).
+ * Policy is defined in its header, so the method is inlined into the loop over calls of the run
+ * and only one virtual call (::getLabels) is made for each run. Controller selects the instance
+ * according to the configuration.
+ */
+template<typename Policy>
+class LabelAggregator: public Aggregator {
+public:
+   /**
+    * @brief Constructor with same parameters as parent constructor.
+    * Only calls parent constructor Aggregator::Aggregator.
+    * @param subroutineSize Minimal subroutine size.
+    * @param jumps Type of jump detector (window or automaton).
+    * @param path Output file destination.
+    * @param graphMemory Maximal size of the memory used by the graph in bytes (0 if not limited).
+    * @param graphDir Directory of files of the graph (used only if its memory is limited).
+    * @param traceMemory Maximal size of the memory used by traces of jump detector in bytes (0 if
+    * not limited).
+    */
+   LabelAggregator(unsigned subroutineSize, std::string jumps, std::string path,
+         size_t graphMemory, std::string graphDir, size_t traceMemory) :
+         Aggregator(subroutineSize, jumps, path, graphMemory, graphDir, traceMemory) {
+   }
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~LabelAggregator() {
+   }
+
+   /**
+    * @brief Converts calls of the run into their labels using the policy.
+    * @param run Run with calls to be converted.
+    * @param labels Vector filled with labels of the calls (in the order of the calls).
+    */
+   void getLabels(Run *run, std::vector<std::string> &labels) {
+      unsigned size = run->getSize();
+      labels.resize(size);
+      for (unsigned i = 0; i < size; ++i) {
+         labels[i].clear();
+         Policy::label(run->getCall(i), labels[i]);
+      }
+   }
+   /**
+    * @brief Converts label to text used in output using the policy.
+    * @param label Label created by ::getLabels.
+    * @return Text of the label.
+    */
+   std::string getText(const std::string &label) {
+      return Policy::text(label);
+   }
+};
+
+#endif /* LABELAGGREGATOR_H_ */
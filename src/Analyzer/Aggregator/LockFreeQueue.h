@@ -0,0 +1,96 @@
+/**
+ * @file LockFreeQueue.h
+ *
+ * @brief LockFreeQueue class template.
+ *
+ * Contains definition of class template LockFreeQueue, a bounded single-producer/single-consumer
+ * queue used for passing items between two threads without locking.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef LOCKFREEQUEUE_H_
+#define LOCKFREEQUEUE_H_
+
+#include <atomic>
+#include <vector>
+#include <thread>
+
+/**
+ * @brief Bounded lock-free queue for one producer and one consumer thread.
+ *
+ * Items are stored in a ring buffer whose capacity is a power of two. Producer only writes
+ * ::tail and consumer only writes ::head, so no locking is needed. When the queue is full, the
+ * producer yields until the consumer makes room.
+ * Queue must be used by exactly one producer thread and one consumer thread.
+ */
+template<typename T>
+class LockFreeQueue {
+public:
+   /**
+    * @brief Constructor with capacity initialization.
+    * Capacity is rounded up to the nearest power of two.
+    * @param size Minimal capacity of the queue.
+    */
+   LockFreeQueue(unsigned size) :
+         head(0), tail(0) {
+      unsigned capacity = 1;
+      while (capacity < size)
+         capacity <<= 1;
+      buffer.resize(capacity);
+      mask = capacity - 1;
+   }
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~LockFreeQueue() {
+   }
+
+   /**
+    * @brief Pushes item to the end of the queue.
+    * If the queue is full, waits until the consumer pops an item.
+    * Must be called from producer thread only.
+    * @param item Item to be pushed.
+    */
+   void push(const T &item) {
+      size_t t = tail.load(std::memory_order_relaxed);
+      // Wait for free slot
+      while (t - head.load(std::memory_order_acquire) > mask)
+         std::this_thread::yield();
+      buffer[t & mask] = item;
+      tail.store(t + 1, std::memory_order_release);
+   }
+   /**
+    * @brief Pops item from the beginning of the queue.
+    * Must be called from consumer thread only.
+    * @param item Reference where the popped item is stored.
+    * @return @a True if an item has been popped, @a false if the queue is empty.
+    */
+   bool pop(T &item) {
+      size_t h = head.load(std::memory_order_relaxed);
+      if (h == tail.load(std::memory_order_acquire))
+         return false;
+      item = buffer[h & mask];
+      head.store(h + 1, std::memory_order_release);
+      return true;
+   }
+   /**
+    * @brief Checks if the queue is empty.
+    * @return @a True if there is no item in the queue, otherwise @a false.
+    */
+   bool empty() {
+      return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+   }
+protected:
+   std::vector<T> buffer; /**< Ring buffer with items */
+   size_t mask; /**< Mask used for getting buffer index from position (capacity - 1) */
+   std::atomic<size_t> head; /**< Position of the next item to be popped (written by consumer) */
+   char padding[64]; /**< Keeps ::head and ::tail in different cache lines */
+   std::atomic<size_t> tail; /**< Position of the next free slot (written by producer) */
+};
+
+#endif /* LOCKFREEQUEUE_H_ */
@@ -0,0 +1,280 @@
+/**
+ * @file MappedArray.h
+ *
+ * @brief MappedArray class template.
+ *
+ * Contains definition of class template MappedArray, a growable array of plain values stored in
+ * mapped memory, optionally backed by a temporary file.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef MAPPEDARRAY_H_
+#define MAPPEDARRAY_H_
+
+#include "Exceptions/ConfigurationException.h"
+
+#include <string>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @brief Growable array stored in a memory mapping.
+ *
+ * Used for arrays of the graph, which may not fit into memory. Only values that can be copied by
+ * bytes can be stored. The mapping is anonymous, or it is a mapping of a temporary file (removed
+ * when the array is destroyed), so that the kernel writes cold pages into the file instead of
+ * keeping them in memory. The mapping is enlarged twice when it is full (the array may move).
+ * In case the mapping can not be enlarged, std::bad_alloc is thrown, as by std::vector.
+ *
+ * If the array has a file, each access records the epoch (eg. number of the run) in which its
+ * page was used last, so that pages not used recently can be released (see ::releaseOlder).
+ */
+template<typename T>
+class MappedArray {
+public:
+   /**
+    * @brief Constructor creating empty array.
+    * @param dir Directory of the file, or empty string if the array is kept in memory.
+    * @throws ConfigurationException In case the file can not be created.
+    */
+   MappedArray(const std::string &dir) :
+         fd(-1), data(NULL), capacity(INITIAL_CAPACITY), count(0), pageShift(0), epoch(1),
+         residentPages(0) {
+      if (!dir.empty()) {
+         std::string path = dir + "/analyzerGraph.XXXXXX";
+         fd = mkostemp(&path[0], O_CLOEXEC);
+         if (fd < 0)
+            throw ConfigurationException("Creating graph file in " + dir + " failed");
+         // File is removed when it is closed
+         unlink(path.c_str());
+         while ((1UL << pageShift) < (size_t) sysconf(_SC_PAGESIZE))
+            ++pageShift;
+      }
+      void *mapping = map(capacity);
+      if (mapping == MAP_FAILED) {
+         if (fd >= 0)
+            close(fd);
+         throw ConfigurationException("Creating graph file in " + dir + " failed");
+      }
+      data = static_cast<T *>(mapping);
+      resizePages();
+   }
+   /**
+    * @brief Default destructor.
+    * Unmaps the array and removes its file.
+    */
+   virtual ~MappedArray() {
+      munmap(data, capacity * sizeof(T));
+      if (fd >= 0)
+         close(fd);
+   }
+
+   /**
+    * @brief Appends value to the end of the array.
+    * @param value Value to be appended.
+    */
+   void push_back(const T &value) {
+      if (count == capacity)
+         grow();
+      touch(count);
+      data[count++] = value;
+   }
+   /**
+    * @brief Removes the last value.
+    */
+   void pop_back() {
+      --count;
+   }
+   /**
+    * @brief Gets the last value.
+    * @return Reference to the last value.
+    */
+   T &back() {
+      touch(count - 1);
+      return data[count - 1];
+   }
+   /**
+    * @brief Gets value at given index.
+    * @param index Index of the value (must be less than size of the array).
+    * @return Reference to the value.
+    */
+   T &operator[](size_t index) {
+      touch(index);
+      return data[index];
+   }
+   /**
+    * @brief Gets number of values in the array.
+    * @return Size of the array.
+    */
+   size_t size() {
+      return count;
+   }
+   /**
+    * @brief Removes all values.
+    * Memory of the array is released.
+    */
+   void clear() {
+      if (count > 0)
+         madvise(data, count * sizeof(T), MADV_DONTNEED);
+      std::fill(pageEpochs.begin(), pageEpochs.end(), 0);
+      residentPages = 0;
+      count = 0;
+   }
+   /**
+    * @brief Exchanges content of two arrays.
+    * @param other Array to be exchanged with.
+    */
+   void swap(MappedArray<T> &other) {
+      std::swap(fd, other.fd);
+      std::swap(data, other.data);
+      std::swap(capacity, other.capacity);
+      std::swap(count, other.count);
+      std::swap(pageShift, other.pageShift);
+      std::swap(epoch, other.epoch);
+      pageEpochs.swap(other.pageEpochs);
+      std::swap(residentPages, other.residentPages);
+      written.swap(other.written);
+   }
+   /**
+    * @brief Starts new epoch, pages used later are newer than the ones used until now.
+    */
+   void nextEpoch() {
+      ++epoch;
+   }
+   /**
+    * @brief Gets size of the pages used since they were released last time.
+    * @return Number of bytes (0 if the array has no file).
+    */
+   size_t residentBytes() {
+      return residentPages << pageShift;
+   }
+   /**
+    * @brief Gets epochs of the pages used since they were released last time.
+    * @param epochs Vector the epochs are appended to.
+    */
+   void getEpochs(std::vector<unsigned> &epochs) {
+      for (auto e : pageEpochs) {
+         if (e != 0)
+            epochs.push_back(e);
+      }
+   }
+   /**
+    * @brief Releases memory of the pages not used since given epoch.
+    * The pages are removed from the mapping and writing of their data into the file is started
+    * without waiting for it, contiguous pages are released together. The pages are removed from
+    * page cache at the next release, when they have been written. They are read again when they
+    * are accessed. Does nothing if the array has no file.
+    * @param oldest Epoch of the oldest pages which are kept.
+    */
+   void releaseOlder(unsigned oldest) {
+      if (fd < 0)
+         return;
+      // Pages written since the last release are clean now
+      for (auto &range : written) {
+         posix_fadvise(fd, range.first, range.second, POSIX_FADV_DONTNEED);
+      }
+      written.clear();
+      for (size_t page = 0; page < pageEpochs.size();) {
+         if (pageEpochs[page] == 0 || pageEpochs[page] >= oldest) {
+            ++page;
+            continue;
+         }
+         size_t first = page;
+         for (; page < pageEpochs.size() && pageEpochs[page] != 0 && pageEpochs[page] < oldest;
+               ++page) {
+            pageEpochs[page] = 0;
+            --residentPages;
+         }
+         size_t offset = first << pageShift;
+         size_t length = (page - first) << pageShift;
+         // Dirty pages of the mapping stay in page cache, their writing starts now
+         madvise(reinterpret_cast<char *>(data) + offset, length, MADV_DONTNEED);
+         sync_file_range(fd, offset, length, SYNC_FILE_RANGE_WRITE);
+         written.push_back(std::make_pair(offset, length));
+      }
+   }
+protected:
+   static const size_t INITIAL_CAPACITY = (1 << 16) / sizeof(T); /**< Initial number of values */
+
+   int fd; /**< Descriptor of the file or -1 if the array is kept in memory */
+   T *data; /**< Mapping with the values */
+   size_t capacity; /**< Number of values the mapping can hold */
+   size_t count; /**< Number of values in the array */
+   unsigned pageShift; /**< Binary logarithm of page size (0 if the array has no file) */
+   unsigned epoch; /**< Current epoch */
+   std::vector<unsigned> pageEpochs; /**< Epoch when each page was used last (0 if it has not
+                                      * been used since it was released) */
+   size_t residentPages; /**< Number of pages used since they were released last time */
+   std::vector<std::pair<size_t, size_t>> written; /**< Offsets and lengths of ranges whose
+                                                    * writing has been started */
+private:
+   /**
+    * @brief Records use of the page with the value.
+    * @param index Index of the value.
+    */
+   void touch(size_t index) {
+      if (fd < 0)
+         return;
+      unsigned &page = pageEpochs[index * sizeof(T) >> pageShift];
+      if (page == 0)
+         ++residentPages;
+      page = epoch;
+   }
+   /**
+    * @brief Resizes epochs of pages to the capacity of the mapping.
+    */
+   void resizePages() {
+      if (fd >= 0)
+         pageEpochs.resize(((capacity * sizeof(T) - 1) >> pageShift) + 1, 0);
+   }
+   /**
+    * @brief Creates mapping of given number of values.
+    * @param values Number of values.
+    * @return Address of the mapping or MAP_FAILED.
+    */
+   void *map(size_t values) {
+      if (fd < 0)
+         return mmap(NULL, values * sizeof(T), PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ftruncate(fd, values * sizeof(T)) != 0)
+         return MAP_FAILED;
+      return mmap(NULL, values * sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   }
+   /**
+    * @brief Enlarges the mapping twice.
+    * @throws std::bad_alloc In case the mapping can not be enlarged.
+    */
+   void grow() {
+      size_t newCapacity = capacity * 2;
+      void *mapping = MAP_FAILED;
+      if (fd < 0 || ftruncate(fd, newCapacity * sizeof(T)) == 0)
+         mapping = mremap(data, capacity * sizeof(T), newCapacity * sizeof(T), MREMAP_MAYMOVE);
+      if (mapping == MAP_FAILED)
+         throw std::bad_alloc();
+      data = static_cast<T *>(mapping);
+      capacity = newCapacity;
+      resizePages();
+   }
+   /**
+    * Array can not be copied, as it owns the mapping.
+    */
+   MappedArray(const MappedArray<T> &);
+   /**
+    * Array can not be assigned, as it owns the mapping.
+    */
+   MappedArray<T> &operator=(const MappedArray<T> &);
+};
+
+#endif /* MAPPEDARRAY_H_ */
@@ -0,0 +1,48 @@
+/**
+ * @file NameLabel.h
+ *
+ * @brief NameLabel class.
+ *
+ * Contains definition of the class NameLabel, label policy aggregating calls by function name.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef NAMELABEL_H_
+#define NAMELABEL_H_
+
+#include "Call.h"
+
+#include <string>
+
+/**
+ * @brief Label policy distinguishing calls by function name only.
+ *
+ * Used by LabelAggregator for aggregator type name. The methods are defined here, so that they
+ * can be inlined.
+ */
+class NameLabel {
+public:
+   /**
+    * @brief Appends label of the call.
+    * @param call Call to be converted.
+    * @param result String the function name is appended to.
+    */
+   static void label(Call call, std::string &result) {
+      result += call.getName();
+   }
+   /**
+    * @brief Converts label to text used in output.
+    * @param label Label created by ::label.
+    * @return Text of the label (the label itself).
+    */
+   static std::string text(const std::string &label) {
+      return label;
+   }
+};
+
+#endif /* NAMELABEL_H_ */
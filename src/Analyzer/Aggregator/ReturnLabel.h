@@ -0,0 +1,57 @@
+/**
+ * @file ReturnLabel.h
+ *
+ * @brief ReturnLabel class.
+ *
+ * Contains definition of the class ReturnLabel, label policy aggregating calls by function name
+ * and class of the return value.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef RETURNLABEL_H_
+#define RETURNLABEL_H_
+
+#include "Call.h"
+#include "Param.h"
+
+#include <string>
+
+/**
+ * @brief Label policy distinguishing calls by function name and by success of the call.
+ *
+ * Used by LabelAggregator for aggregator type name_return. The label is function name followed
+ * by "=err" if the call failed (it returned negative number, NULL or MAP_FAILED), otherwise by
+ * "=ok". Calls of void functions always succeed. The methods are defined here, so that they can
+ * be inlined.
+ */
+class ReturnLabel {
+public:
+   /**
+    * @brief Appends label of the call.
+    * @param call Call to be converted.
+    * @param result String the label is appended to.
+    */
+   static void label(Call call, std::string &result) {
+      Param value = call.getReturnVal();
+      int64_t number = value.getNumber();
+      bool failed = (value.getType() == PT_INT && number < 0)
+            || (value.getType() == PT_POINTER && (number == 0 || number == -1));
+      result += call.getName();
+      result += failed ? "=err" : "=ok";
+   }
+   /**
+    * @brief Converts label to text used in output.
+    * @param label Label created by ::label.
+    * @return Text of the label (the label itself).
+    */
+   static std::string text(const std::string &label) {
+      return label;
+   }
+};
+
+#endif /* RETURNLABEL_H_ */
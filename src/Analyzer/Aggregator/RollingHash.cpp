@@ -0,0 +1,80 @@
+/**
+ * @file RollingHash.cpp
+ *
+ * Contains implementation of methods of the class RollingHash.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/RollingHash.h"
+
+/**
+ * @brief Constructor creating hash of the window of label 0.
+ * @param s Number of labels in the window.
+ */
+RollingHash::RollingHash(unsigned s) :
+      value(0), top(1), inverse(BASE) {
+   for (unsigned i = 1; i < s; ++i) {
+      top *= BASE;
+   }
+   // Newton's iteration, each step doubles the number of correct bits (3 for odd number)
+   for (unsigned i = 0; i < 5; ++i) {
+      inverse *= 2 - BASE * inverse;
+   }
+}
+
+/**
+ * @brief Default destructor.
+ */
+RollingHash::~RollingHash() {
+}
+
+/**
+ * @brief Moves the window forward.
+ * @param in Label appended to the end of the window.
+ * @param out Label removed from the beginning of the window.
+ */
+void RollingHash::push(unsigned in, unsigned out) {
+   value = (value - out * top) * BASE + in;
+}
+
+/**
+ * @brief Moves the window backward.
+ * @param in Label prepended to the beginning of the window.
+ * @param out Label removed from the end of the window.
+ */
+void RollingHash::pushFront(unsigned in, unsigned out) {
+   value = (value - out) * inverse + in * top;
+}
+
+/**
+ * @brief Sets the hash to the window of label 0.
+ */
+void RollingHash::clear() {
+   value = 0;
+}
+
+/**
+ * @brief Gets the hash of the window.
+ * @return Hash value.
+ */
+uint64_t RollingHash::getValue() {
+   return value;
+}
+
+/**
+ * @brief Computes hash of the labels.
+ * @param labels Labels of the window.
+ * @return Hash value equal to the one of a rolling hash moved over the labels.
+ */
+uint64_t RollingHash::of(const std::vector<unsigned> &labels) {
+   uint64_t result = 0;
+   for (auto label : labels) {
+      result = result * BASE + label;
+   }
+   return result;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file RollingHash.h
+ *
+ * @brief RollingHash class.
+ *
+ * Contains definition of the class RollingHash, a hash of a window of labels which can be moved
+ * by one label in constant time.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef ROLLINGHASH_H_
+#define ROLLINGHASH_H_
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Polynomial hash of a window of label symbols with fixed size.
+ *
+ * For labels l(0) ... l(n-1) of the window (l(0) is the first one) the hash is
+ * sum of l(i) * B^(n-1-i) modulo 2^64. When the window moves by one label forward or backward,
+ * the hash is updated from the label entering and the label leaving the window, so it does
+ * not depend on the size of the window. B is odd, so it can be inverted for moving backward.
+ * Empty hash corresponds to the window filled with label 0.
+ */
+class RollingHash {
+public:
+   /**
+    * @brief Constructor creating hash of the window of label 0.
+    * @param s Number of labels in the window.
+    */
+   RollingHash(unsigned s);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~RollingHash();
+
+   /**
+    * @brief Moves the window forward.
+    * @param in Label appended to the end of the window.
+    * @param out Label removed from the beginning of the window.
+    */
+   void push(unsigned in, unsigned out);
+   /**
+    * @brief Moves the window backward.
+    * @param in Label prepended to the beginning of the window.
+    * @param out Label removed from the end of the window.
+    */
+   void pushFront(unsigned in, unsigned out);
+   /**
+    * @brief Sets the hash to the window of label 0.
+    */
+   void clear();
+   /**
+    * @brief Gets the hash of the window.
+    * @return Hash value.
+    */
+   uint64_t getValue();
+   /**
+    * @brief Computes hash of the labels.
+    * @param labels Labels of the window.
+    * @return Hash value equal to the one of a rolling hash moved over the labels.
+    */
+   static uint64_t of(const std::vector<unsigned> &labels);
+protected:
+   static const uint64_t BASE = 0x9E3779B97F4A7C15ULL; /**< Base of the polynomial (odd) */
+
+   uint64_t value; /**< Hash of the window */
+   uint64_t top; /**< BASE^(size-1), weight of the first label */
+   uint64_t inverse; /**< Multiplicative inverse of BASE modulo 2^64 */
+};
+
+#endif /* ROLLINGHASH_H_ */
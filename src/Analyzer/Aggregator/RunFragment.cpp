@@ -0,0 +1,74 @@
+/**
+ * @file RunFragment.cpp
+ *
+ * Contains implementation of methods of the class RunFragment.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/RunFragment.h"
+#include "Aggregator/Aggregator.h"
+
+/**
+ * @brief Constructor creating fragment from run.
+ * Computes labels of all calls of the run using given aggregator.
+ * @param r Run the fragment is created from.
+ * @param aggregator Aggregator used for converting calls into labels.
+ */
+RunFragment::RunFragment(Run *r, Aggregator *aggregator) :
+      run(r), labels(), inserted(false), merged(false) {
+   aggregator->getLabels(run, labels);
+}
+
+/**
+ * @brief Default destructor.
+ * Run is not destroyed, because it can outlive the fragment.
+ */
+RunFragment::~RunFragment() {
+}
+
+/**
+ * @brief Gets the run the fragment was created from.
+ * @return Pointer to the run.
+ */
+Run *RunFragment::getRun() {
+   return run;
+}
+
+/**
+ * @brief Gets labels of the calls in the fragment.
+ * @return Vector of labels.
+ */
+const std::vector<std::string> &RunFragment::getLabels() {
+   return labels;
+}
+
+/**
+ * @brief Sets fragment merged into the graph.
+ * @param nodeInserted @a True if some node has been inserted into the graph during merging.
+ */
+void RunFragment::setMerged(bool nodeInserted) {
+   inserted = nodeInserted;
+   merged.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Checks if the fragment has already been merged into the graph.
+ * @return @a True if the fragment has been merged, otherwise @a false.
+ */
+bool RunFragment::isMerged() {
+   return merged.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Checks if a node has been inserted into the graph when merging the fragment.
+ * Valid only after the fragment has been merged.
+ * @return @a True if any node has been inserted, otherwise @a false.
+ */
+bool RunFragment::nodeInserted() {
+   return inserted;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file RunFragment.h
+ *
+ * @brief RunFragment class.
+ *
+ * Contains definition of the class RunFragment, a private part of the graph created from a single
+ * run before it is merged into the global graph.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef RUNFRAGMENT_H_
+#define RUNFRAGMENT_H_
+
+#include "Run.h"
+
+#include <vector>
+#include <string>
+#include <atomic>
+
+// Forward declaration of class Aggregator (for linker)
+class Aggregator;
+
+/**
+ * @brief Fragment of the graph created from one run.
+ *
+ * Fragment is a path in the prefix tree, containing labels of all calls of the run in the order
+ * in which they were performed. It is built by the worker that executed the run, without touching
+ * the global graph, so labels of different runs can be computed in parallel. Merging of the
+ * fragment into the global graph is done later by Aggregator::addRun.
+ */
+class RunFragment {
+public:
+   /**
+    * @brief Constructor creating fragment from run.
+    * Computes labels of all calls of the run using given aggregator.
+    * @param r Run the fragment is created from.
+    * @param aggregator Aggregator used for converting calls into labels.
+    */
+   RunFragment(Run *r, Aggregator *aggregator);
+   /**
+    * @brief Default destructor.
+    * Run is not destroyed, because it can outlive the fragment.
+    */
+   virtual ~RunFragment();
+
+   /**
+    * @brief Gets the run the fragment was created from.
+    * @return Pointer to the run.
+    */
+   Run *getRun();
+   /**
+    * @brief Gets labels of the calls in the fragment.
+    * @return Vector of labels.
+    */
+   const std::vector<std::string> &getLabels();
+   /**
+    * @brief Sets fragment merged into the graph.
+    * @param nodeInserted @a True if some node has been inserted into the graph during merging.
+    */
+   void setMerged(bool nodeInserted);
+   /**
+    * @brief Checks if the fragment has already been merged into the graph.
+    * @return @a True if the fragment has been merged, otherwise @a false.
+    */
+   bool isMerged();
+   /**
+    * @brief Checks if a node has been inserted into the graph when merging the fragment.
+    * Valid only after the fragment has been merged.
+    * @return @a True if any node has been inserted, otherwise @a false.
+    */
+   bool nodeInserted();
+protected:
+   Run *run; /**< Run the fragment was created from */
+   std::vector<std::string> labels; /**< Labels of calls in the run */
+   bool inserted; /**< Flag set when a node has been inserted during merging */
+   std::atomic<bool> merged; /**< Flag set after the fragment has been merged */
+};
+
+#endif /* RUNFRAGMENT_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @file SuccessorMap.cpp
+ *
+ * Contains implementation of methods of the class SuccessorMap.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/SuccessorMap.h"
+
+/**
+ * Initial number of entries of the table.
+ */
+static const size_t INITIAL_SIZE = 64;
+
+/**
+ * @brief Packs node and label into key.
+ * @param node Index of the node.
+ * @param label Symbol of the label.
+ * @return Key of the table.
+ */
+static inline uint64_t makeKey(unsigned node, unsigned label) {
+   return (uint64_t) node << 32 | label;
+}
+
+/**
+ * @brief Default constructor.
+ * Creates empty map.
+ */
+SuccessorMap::SuccessorMap() :
+      table(INITIAL_SIZE, TEntry { EMPTY, 0 }), used(0) {
+}
+
+/**
+ * @brief Default destructor.
+ */
+SuccessorMap::~SuccessorMap() {
+}
+
+/**
+ * @brief Finds successor of the node with given label.
+ * @param node Index of the node in graph.
+ * @param label Symbol of the label of the successor.
+ * @return Index of the successor in graph or 0 if there is no such successor.
+ */
+unsigned SuccessorMap::find(unsigned node, unsigned label) {
+   TEntry &entry = table[position(makeKey(node, label))];
+   return entry.key == EMPTY ? 0 : entry.successor;
+}
+
+/**
+ * @brief Adds successor of the node.
+ * If the node already has a successor with the label, the map is not changed.
+ * @param node Index of the node in graph.
+ * @param label Symbol of the label of the successor.
+ * @param successor Index of the successor in graph.
+ */
+void SuccessorMap::insert(unsigned node, unsigned label, unsigned successor) {
+   // At most half of the table is used, so that probe sequences stay short
+   if (2 * (used + 1) > table.size())
+      rebuild();
+   uint64_t key = makeKey(node, label);
+   size_t pos = position(key);
+   if (table[pos].key == key)
+      return;
+   // Removed entry on the probe sequence is reused
+   size_t mask = table.size() - 1;
+   size_t first = home(key);
+   while (table[first].key != REMOVED && first != pos)
+      first = (first + 1) & mask;
+   if (first == pos)
+      ++used;
+   table[first].key = key;
+   table[first].successor = successor;
+}
+
+/**
+ * @brief Removes successor of the node.
+ * The map is changed only if it contains given successor for the label.
+ * @param node Index of the node in graph.
+ * @param label Symbol of the label of the successor.
+ * @param successor Index of the successor in graph.
+ */
+void SuccessorMap::erase(unsigned node, unsigned label, unsigned successor) {
+   TEntry &entry = table[position(makeKey(node, label))];
+   if (entry.key != EMPTY && entry.successor == successor)
+      entry.key = REMOVED;
+}
+
+/**
+ * @brief Removes all entries.
+ */
+void SuccessorMap::clear() {
+   table.assign(INITIAL_SIZE, TEntry { EMPTY, 0 });
+   used = 0;
+}
+
+/**
+ * @brief Finds position of the key in the table.
+ * @param key Key to be found.
+ * @return Position of the entry with the key or of the empty entry where the search ended.
+ */
+size_t SuccessorMap::position(uint64_t key) {
+   size_t mask = table.size() - 1;
+   size_t pos = home(key);
+   while (table[pos].key != key && table[pos].key != EMPTY)
+      pos = (pos + 1) & mask;
+   return pos;
+}
+
+/**
+ * @brief Gets the first position where the key is searched.
+ * Fibonacci hashing is used, so keys of successive nodes are spread over the table.
+ * @param key Key of the entry.
+ * @return Position in the table.
+ */
+size_t SuccessorMap::home(uint64_t key) {
+   return (key * 0x9E3779B97F4A7C15ULL >> 32) & (table.size() - 1);
+}
+
+/**
+ * @brief Rebuilds the table without removed entries.
+ * Size of the table is chosen so that at most a quarter of it is used.
+ */
+void SuccessorMap::rebuild() {
+   std::vector<TEntry> old;
+   old.swap(table);
+   size_t live = 0;
+   for (auto &entry : old) {
+      if (entry.key != EMPTY && entry.key != REMOVED)
+         ++live;
+   }
+   size_t size = INITIAL_SIZE;
+   while (size < 4 * (live + 1))
+      size *= 2;
+   table.assign(size, TEntry { EMPTY, 0 });
+   used = 0;
+   size_t mask = size - 1;
+   for (auto &entry : old) {
+      if (entry.key != EMPTY && entry.key != REMOVED) {
+         size_t pos = home(entry.key);
+         while (table[pos].key != EMPTY)
+            pos = (pos + 1) & mask;
+         table[pos] = entry;
+         ++used;
+      }
+   }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file SuccessorMap.h
+ *
+ * @brief SuccessorMap class.
+ *
+ * Contains definition of the class SuccessorMap, an index of successors of graph nodes by their
+ * labels.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef SUCCESSORMAP_H_
+#define SUCCESSORMAP_H_
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Map from node and label to the successor of the node with that label.
+ *
+ * Used by aggregator to find successor of the current node with the label of incoming call in
+ * constant time, regardless of the number of successors of the node. Successors of a node have
+ * distinct labels, as a node is inserted only if the successor with its label does not exist.
+ *
+ * The map is one hash table for the whole graph using open addressing with linear probing. Keys
+ * are node index and label symbol packed into a 64-bit number. Removed entries are marked and
+ * reused, the table is rebuilt when it becomes too full.
+ */
+class SuccessorMap {
+public:
+   /**
+    * @brief Default constructor.
+    * Creates empty map.
+    */
+   SuccessorMap();
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~SuccessorMap();
+
+   /**
+    * @brief Finds successor of the node with given label.
+    * @param node Index of the node in graph.
+    * @param label Symbol of the label of the successor.
+    * @return Index of the successor in graph or 0 if there is no such successor.
+    */
+   unsigned find(unsigned node, unsigned label);
+   /**
+    * @brief Adds successor of the node.
+    * If the node already has a successor with the label, the map is not changed.
+    * @param node Index of the node in graph.
+    * @param label Symbol of the label of the successor.
+    * @param successor Index of the successor in graph.
+    */
+   void insert(unsigned node, unsigned label, unsigned successor);
+   /**
+    * @brief Removes successor of the node.
+    * The map is changed only if it contains given successor for the label.
+    * @param node Index of the node in graph.
+    * @param label Symbol of the label of the successor.
+    * @param successor Index of the successor in graph.
+    */
+   void erase(unsigned node, unsigned label, unsigned successor);
+   /**
+    * @brief Removes all entries.
+    */
+   void clear();
+protected:
+   /**
+    * Entry of the table.
+    */
+   typedef struct {
+      uint64_t key; /**< Node and label, or ::EMPTY or ::REMOVED */
+      unsigned successor; /**< Index of the successor */
+   } TEntry;
+
+   static const uint64_t EMPTY = ~0ULL; /**< Key of entry which has never been used */
+   static const uint64_t REMOVED = ~0ULL - 1; /**< Key of removed entry */
+
+   std::vector<TEntry> table; /**< Entries, size is a power of 2 */
+   size_t used; /**< Number of entries which are not empty (including removed) */
+private:
+   /**
+    * @brief Finds position of the key in the table.
+    * @param key Key to be found.
+    * @return Position of the entry with the key or of the empty entry where the search ended.
+    */
+   size_t position(uint64_t key);
+   /**
+    * @brief Gets the first position where the key is searched.
+    * Fibonacci hashing is used, so keys of successive nodes are spread over the table.
+    * @param key Key of the entry.
+    * @return Position in the table.
+    */
+   size_t home(uint64_t key);
+   /**
+    * @brief Rebuilds the table without removed entries.
+    * Size of the table is chosen so that at most a quarter of it is used.
+    */
+   void rebuild();
+};
+
+#endif /* SUCCESSORMAP_H_ */
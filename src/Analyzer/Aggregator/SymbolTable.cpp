@@ -0,0 +1,67 @@
+/**
+ * @file SymbolTable.cpp
+ *
+ * Contains implementation of methods of the class SymbolTable.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Aggregator/SymbolTable.h"
+
+/**
+ * @brief Default constructor.
+ * Creates empty table.
+ */
+SymbolTable::SymbolTable() :
+      symbols(), labels() {
+}
+
+/**
+ * @brief Default destructor.
+ */
+SymbolTable::~SymbolTable() {
+}
+
+/**
+ * @brief Gets symbol of the label.
+ * If the label is not in the table yet, it is added with new symbol.
+ * @param label Label to be interned.
+ * @return Symbol of the label.
+ */
+unsigned SymbolTable::intern(const std::string &label) {
+   auto symbolIt = symbols.find(label);
+   if (symbolIt != symbols.end())
+      return symbolIt->second;
+   symbolIt = symbols.insert(std::make_pair(label, (unsigned) labels.size())).first;
+   labels.push_back(&symbolIt->first);
+   return symbolIt->second;
+}
+
+/**
+ * @brief Gets label of the symbol.
+ * @param symbol Symbol (must be less than size of the table).
+ * @return Label of the symbol.
+ */
+const std::string &SymbolTable::getLabel(unsigned symbol) {
+   return *labels[symbol];
+}
+
+/**
+ * @brief Gets number of symbols in the table.
+ * @return Number of symbols.
+ */
+unsigned SymbolTable::getSize() {
+   return labels.size();
+}
+
+/**
+ * @brief Removes all symbols.
+ */
+void SymbolTable::clear() {
+   symbols.clear();
+   labels.clear();
+}
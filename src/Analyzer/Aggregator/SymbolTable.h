@@ -0,0 +1,76 @@
+/**
+ * @file SymbolTable.h
+ *
+ * @brief SymbolTable class.
+ *
+ * Contains definition of the class SymbolTable, which assigns integer identifiers to labels of
+ * calls.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef SYMBOLTABLE_H_
+#define SYMBOLTABLE_H_
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+
+/**
+ * @brief Table of interned labels.
+ *
+ * Each distinct label is stored only once and gets a 32-bit identifier (symbol), identifiers are
+ * assigned from 0 in the order in which labels are interned. Nodes of the graph keep only
+ * the symbol of their label, so labels are compared as integers during aggregation and converted
+ * back to strings only for output.
+ */
+class SymbolTable {
+public:
+   /**
+    * @brief Default constructor.
+    * Creates empty table.
+    */
+   SymbolTable();
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~SymbolTable();
+
+   /**
+    * @brief Gets symbol of the label.
+    * If the label is not in the table yet, it is added with new symbol.
+    * @param label Label to be interned.
+    * @return Symbol of the label.
+    */
+   unsigned intern(const std::string &label);
+   /**
+    * @brief Gets label of the symbol.
+    * @param symbol Symbol (must be less than size of the table).
+    * @return Label of the symbol.
+    */
+   const std::string &getLabel(unsigned symbol);
+   /**
+    * @brief Gets number of symbols in the table.
+    * @return Number of symbols.
+    */
+   unsigned getSize();
+   /**
+    * @brief Removes all symbols.
+    */
+   void clear();
+protected:
+   /**
+    * Map from labels to their symbols.
+    */
+   std::unordered_map<std::string, unsigned> symbols;
+   /**
+    * Labels indexed by their symbols (keys of ::symbols, they do not move when the map grows).
+    */
+   std::vector<const std::string *> labels;
+};
+
+#endif /* SYMBOLTABLE_H_ */
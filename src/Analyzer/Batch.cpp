@@ -0,0 +1,181 @@
+/**
+ * @file Batch.cpp
+ *
+ * Contains implementation of methods of the class Batch.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Batch.h"
+#include "Controller.h"
+#include "Worker/LocalWorker.h"
+#include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
+#include "Exceptions/SocketException.h"
+
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <set>
+#include <exception>
+
+/**
+ * @brief Constructor reading the manifest and creating pool of workers.
+ * @param manifest Name of the file with list of jobs.
+ * @param workers Number of workers shared by all jobs.
+ * @throws ConfigurationException In case the manifest can not be read.
+ * @throws SocketException In case a socket can not be created.
+ */
+Batch::Batch(std::string manifest, unsigned workers) :
+      nextJob(0), workerPool(NULL) {
+   std::ifstream manifestFile;
+   manifestFile.open(manifest, std::ifstream::in);
+   if (!manifestFile.is_open())
+      // Open failure
+      throw ConfigurationException("Error opening manifest file");
+
+   std::string line;
+   while (std::getline(manifestFile, line)) {
+      std::istringstream isLine(line);
+      Job job;
+      if (!(isLine >> job.filename) || job.filename[0] == '#')
+         // Empty line or comment
+         continue;
+      std::string arg;
+      while (isLine >> arg)
+         job.program.push_back(arg);
+      job.name = job.filename;
+      for (auto &a : job.program)
+         job.name += " " + a;
+      job.config = NULL;
+      job.nodes = 0;
+      job.runs = 0;
+      job.seconds = 0;
+      jobs.push_back(job);
+   }
+   if (jobs.empty())
+      throw ConfigurationException("No jobs in manifest file");
+
+   std::vector<Worker *> localWorkers;
+   for (unsigned i = 0; i < workers; ++i) {
+      localWorkers.push_back(
+            new LocalWorker(
+                  "/tmp/analyserSocket." + std::to_string(getpid()) + "." + std::to_string(i)));
+   }
+   workerPool = new WorkerPool(localWorkers);
+}
+
+/**
+ * @brief Default destructor.
+ * Deletes configurations of jobs and stops workers.
+ */
+Batch::~Batch() {
+   for (auto &job : jobs)
+      delete job.config;
+   delete workerPool;
+}
+
+/**
+ * @brief Analyzes all jobs of the batch.
+ * Configurations of all jobs are parsed first, so that invalid jobs and jobs writing into the same
+ * destination as a previous job fail before any analysis starts. Failure of a job does not stop
+ * other jobs, it is only noted in the summary.
+ */
+void Batch::start() {
+   std::set<std::string> destinations;
+   for (auto &job : jobs) {
+      Configuration *config = new Configuration();
+      try {
+         config->parseText(Configuration::readFile(job.filename, job.program));
+      } catch (ConfigurationException &e) {
+         job.error = "Configuration error: " + e.getDescription();
+         delete config;
+         continue;
+      }
+      job.destination = config->getDestination();
+      if (!destinations.insert(job.destination).second) {
+         job.error = "Configuration error: Destination " + job.destination
+               + " is used by previous job";
+         delete config;
+         continue;
+      }
+      job.config = config;
+   }
+
+   // Each thread takes jobs one by one, so at most as many jobs as workers run at the same time
+   std::vector<std::thread> threads;
+   unsigned threadsCnt = std::min<unsigned>(workerPool->getSize(), jobs.size());
+   for (unsigned i = 0; i < threadsCnt; ++i)
+      threads.push_back(std::thread(&Batch::runJobs, this));
+   for (auto &thread : threads)
+      thread.join();
+}
+
+/**
+ * @brief Prints summary of all jobs to standard error output.
+ * Called at the end of the batch.
+ */
+void Batch::printSummary() {
+   unsigned failed = 0;
+   for (auto &job : jobs) {
+      std::cerr << job.name << ": ";
+      if (job.error.empty()) {
+         std::cerr << job.nodes << " nodes, " << job.runs << " runs, " << std::fixed
+               << std::setprecision(2) << job.seconds << " s, output " << job.destination
+               << std::endl;
+      }
+      else {
+         std::cerr << job.error << std::endl;
+         failed++;
+      }
+   }
+   std::cerr << "Batch terminated: " << jobs.size() - failed << " of " << jobs.size()
+         << " jobs successful." << std::endl;
+}
+
+/**
+ * @brief Main function of threads running jobs.
+ * Takes jobs one by one until all jobs are started.
+ */
+void Batch::runJobs() {
+   unsigned index;
+   while ((index = nextJob++) < jobs.size()) {
+      if (jobs[index].config != NULL)
+         runJob(jobs[index]);
+   }
+}
+
+/**
+ * @brief Analyzes one job.
+ * Any error is stored into the job, so that other jobs continue and the summary is printed.
+ * @param job Job to be analyzed, result of the analysis is stored into it.
+ */
+void Batch::runJob(Job &job) {
+   std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+   try {
+      Controller controller(job.config, workerPool);
+      controller.startAnalysis();
+      job.nodes = controller.getNodesCnt();
+      job.runs = controller.getRunsCnt();
+   } catch (SocketException &e) {
+      job.error = "Socket error: " + e.getDescription();
+   } catch (ProtocolException &e) {
+      job.error = "Communication protocol error: " + e.getDescription();
+   } catch (ConfigurationException &e) {
+      job.error = "Configuration error: " + e.getDescription();
+   } catch (std::exception &e) {
+      // Failure of one job (e.g. memory exhaustion) does not stop the batch
+      job.error = std::string("Error: ") + e.what();
+   } catch (...) {
+      job.error = "Unknown error";
+   }
+   job.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
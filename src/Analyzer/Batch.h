@@ -0,0 +1,97 @@
+/**
+ * @file Batch.h
+ *
+ * @brief Batch class.
+ *
+ * Contains definition of the class Batch, which analyzes a suite of configurations concurrently.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#include "Configuration.h"
+#include "Worker/WorkerPool.h"
+
+#include <string>
+#include <vector>
+#include <atomic>
+
+/**
+ * @brief Analysis of several jobs sharing one pool of workers.
+ *
+ * Used when the analyzer is started as "analyzer --batch MANIFEST [WORKERS]". Each line of
+ * the manifest contains one job in form "FILENAME [PROGRAM...]", where FILENAME is configuration
+ * file of the job and PROGRAM optionally replaces its tested program.
+ * Runs of all jobs are executed by one pool of workers. At most as many jobs as there are workers
+ * are analyzed at the same time, so that a short job does not wait for end of a long one while
+ * the workers are still able to keep busy. Each job writes its own output file, summary of all
+ * jobs is printed at the end.
+ */
+class Batch {
+public:
+   /**
+    * @brief Constructor reading the manifest and creating pool of workers.
+    * @param manifest Name of the file with list of jobs.
+    * @param workers Number of workers shared by all jobs.
+    * @throws ConfigurationException In case the manifest can not be read.
+    * @throws SocketException In case a socket can not be created.
+    */
+   Batch(std::string manifest, unsigned workers);
+   /**
+    * @brief Default destructor.
+    * Deletes configurations of jobs and stops workers.
+    */
+   virtual ~Batch();
+
+   /**
+    * @brief Analyzes all jobs of the batch.
+    * Configurations of all jobs are parsed first, so that invalid jobs and jobs writing into
+    * the same destination as a previous job fail before any analysis starts. Failure of a job does
+    * not stop other jobs, it is only noted in the summary.
+    */
+   void start();
+   /**
+    * @brief Prints summary of all jobs to standard error output.
+    * Called at the end of the batch.
+    */
+   void printSummary();
+protected:
+   /**
+    * @brief Job of the batch.
+    */
+   struct Job {
+      std::string name; /**< Line of the manifest describing the job */
+      std::string filename; /**< Configuration file */
+      std::vector<std::string> program; /**< Tested program replacing the one from the file */
+      Configuration *config; /**< Parsed configuration (NULL if it is invalid) */
+      std::string destination; /**< Output file */
+      std::string error; /**< Description of error (empty if analysis succeeded) */
+      unsigned nodes; /**< Number of nodes in the graph */
+      unsigned runs; /**< Number of different runs */
+      double seconds; /**< Duration of the analysis */
+   };
+
+   std::vector<Job> jobs; /**< Jobs in order of the manifest */
+   std::atomic<unsigned> nextJob; /**< Index of the first job not started yet */
+   WorkerPool *workerPool; /**< Pool of workers shared by all jobs */
+private:
+   /**
+    * @brief Main function of threads running jobs.
+    * Takes jobs one by one until all jobs are started.
+    */
+   void runJobs();
+   /**
+    * @brief Analyzes one job.
+    * Any error is stored into the job, so that other jobs continue and the summary is printed.
+    * @param job Job to be analyzed, result of the analysis is stored into it.
+    */
+   void runJob(Job &job);
+};
+
+#endif /* BATCH_H_ */
@@ -11,35 +11,18 @@
  */
 
 #include "Call.h"
+#include "Trace.h"
 
 #include <algorithm>
+#include <iostream>
 
 /**
- * @brief Default constructor.
- * Creates empty call.
+ * @brief Constructor creating view of the call in the trace.
+ * @param t Trace containing the call.
+ * @param i Index of the call in the trace.
  */
-Call::Call() :
-      function(), functionName(""), params(), returnValue(""), usedVariant(0) {
-}
-
-/**
- * @brief Default destructor.
- * Is responsible for deleting all call parameters.
- */
-Call::~Call() {
-   for (auto param : params) {
-      delete param;
-   }
-}
-
-/**
- * @brief Sets function by name.
- * Sets the function name and also the function value using dictionary ::functionsMap.
- * @param name Name of the function to be set to.
- */
-void Call::setFunctionName(std::string name) {
-   functionName = name;
-   function = functionsMap[name];
+Call::Call(Trace *t, unsigned i) :
+      trace(t), index(i) {
 }
 
 /**
@@ -47,7 +30,7 @@ void Call::setFunctionName(std::string name) {
  * @return The function value of type ::functions.
  */
 functions Call::getFunction() {
-   return function;
+   return trace->functionIds[index];
 }
 
 /**
@@ -55,27 +38,17 @@ functions Call::getFunction() {
  * @return Name of the function.
  */
 std::string Call::getName() {
-   return functionName;
-}
-
-/**
- * @brief Adds new parameter to the call.
- * @param p Pointer to the new parameter.
- */
-void Call::addParam(Param *p) {
-   params.push_back(p);
+   return trace->getString(trace->names[index]);
 }
 
 /**
  * @brief Gets parameter on given index.
- * @param index Index of parameter.
- * @return Pointer to parameter object.
+ * @param i Index of parameter.
+ * @return View of the parameter.
  */
-Param *Call::getParam(unsigned index) {
-   if (index >= 0 && index < params.size())
-      return params[index];
-   else
-      return NULL;
+Param Call::getParam(unsigned i) {
+   Trace::TValue &value = trace->params[trace->paramsBegin[index] + i];
+   return Param(trace, value.type, value.number);
 }
 
 /**
@@ -83,23 +56,16 @@ Param *Call::getParam(unsigned index) {
  * @return Number of parameters of the call.
  */
 int Call::paramsCnt() {
-   return params.size();
-}
-
-/**
- * @brief Sets the return value of the call.
- * @param val String containing return value of the call.
- */
-void Call::setReturnVal(std::string val) {
-   returnValue = val;
+   return trace->paramsEnd(index) - trace->paramsBegin[index];
 }
 
 /**
  * @brief Gets the return value of the call.
- * @return String with the return value of the function.
+ * @return View of the return value of the function.
  */
-std::string Call::getReturnVal() {
-   return returnValue;
+Param Call::getReturnVal() {
+   Trace::TValue &value = trace->returnValues[index];
+   return Param(trace, value.type, value.number);
 }
 
 /**
@@ -108,7 +74,7 @@ std::string Call::getReturnVal() {
  * @param v The number of variant.
  */
 void Call::setVariant(int v) {
-   usedVariant = v;
+   trace->variants[index] = v;
 }
 
 /**
@@ -116,7 +82,27 @@ void Call::setVariant(int v) {
  * @return Number of variant.
  */
 int Call::getVariant() {
-   return usedVariant;
+   return trace->variants[index];
+}
+
+/**
+ * Prints the parameters of the call to standard output.
+ */
+void Call::printParams() {
+   for (int i = 0; i < paramsCnt(); ++i) {
+      std::cout << getParam(i).toString() << ", ";
+   }
+}
+
+/**
+ * @brief Converts function name to the function.
+ * Uses dictionary ::functionsMap.
+ * @param name Name of the function.
+ * @return The function value or default value of ::functions if the name is unknown.
+ */
+functions Call::findFunction(const std::string &name) {
+   auto funIt = functionsMap.find(name);
+   return funIt != functionsMap.end() ? funIt->second : functions();
 }
 
 /**
@@ -22,6 +22,9 @@
 #include <vector>
 #include <map>
 
+// Forward declaration of class Trace (for linker)
+class Trace;
+
 /**
  * Enumeration type representing all supported functions.
  */
@@ -44,25 +47,18 @@ typedef std::map<std::string, functions> TFunMap;
  *
  * Class representing one single call of a library function in tested program.
  * Provides information about called function and specified parameters.
+ * Data of calls are stored in columns of the trace the call belongs to (see Trace), the call is
+ * only a lightweight view of one row, so it is passed by value.
  */
 class Call {
 public:
    /**
-    * @brief Default constructor.
-    * Creates empty call.
-    */
-   Call();
-   /**
-    * @brief Default destructor.
-    * Is responsible for deleting all call parameters.
+    * @brief Constructor creating view of the call in the trace.
+    * @param t Trace containing the call.
+    * @param i Index of the call in the trace.
     */
-   virtual ~Call();
-   /**
-    * @brief Sets function by name.
-    * Sets the function name and also the function value using dictionary ::functionsMap.
-    * @param name Name of the function to be set to.
-    */
-   void setFunctionName(std::string name);
+   Call(Trace *t, unsigned i);
+
    /**
     * @brief Gets the function.
     * @return The function value of type ::functions.
@@ -73,32 +69,22 @@ public:
     * @return Name of the function.
     */
    std::string getName();
-   /**
-    * @brief Adds new parameter to the call.
-    * @param p Pointer to the new parameter.
-    */
-   void addParam(Param *p);
    /**
     * @brief Gets parameter on given index.
-    * @param index Index of parameter.
-    * @return Pointer to parameter object.
+    * @param i Index of parameter.
+    * @return View of the parameter.
     */
-   Param *getParam(unsigned index);
+   Param getParam(unsigned i);
    /**
     * @brief Gets parameters count.
     * @return Number of parameters of the call.
     */
    int paramsCnt();
-   /**
-    * @brief Sets the return value of the call.
-    * @param val String containing return value of the call.
-    */
-   void setReturnVal(std::string val);
    /**
     * @brief Gets the return value of the call.
-    * @return String with the return value of the function.
+    * @return View of the return value of the function.
     */
-   std::string getReturnVal();
+   Param getReturnVal();
    /**
     * @brief Sets the variant of the call.
     * Sets which variant has been used to the call in the flow it belongs to.
@@ -114,12 +100,15 @@ public:
    /**
     * Prints the parameters of the call to standard output.
     */
-   void printParams() {
-      for (std::vector<Param *>::iterator it = params.begin(); it != params.end(); ++it) {
-         (*it)->print();
-      }
-   }
+   void printParams();
 
+   /**
+    * @brief Converts function name to the function.
+    * Uses dictionary ::functionsMap.
+    * @param name Name of the function.
+    * @return The function value or default value of ::functions if the name is unknown.
+    */
+   static functions findFunction(const std::string &name);
    /**
     * @brief Checks if the function of given name is valid.
     * Tries to find the function in ::functionsMap.
@@ -137,11 +126,8 @@ public:
    static bool isControlFunction(std::string fun);
 
 protected:
-   functions function; /**< The function called */
-   std::string functionName; /**< Name of the function called */
-   std::vector<Param *> params; /**< Vector of parameters of the call */
-   std::string returnValue; /**< Return value of the call */
-   int usedVariant; /**< A variant used for the call in the flow that the call belongs to */
+   Trace *trace; /**< Trace containing the call */
+   unsigned index; /**< Index of the call in the trace */
 
 private:
    /**
@@ -0,0 +1,267 @@
+/**
+ * @file Checkpoint.cpp
+ *
+ * Contains implementation of methods of the class Checkpoint.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Checkpoint.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/**
+ * Magic number at the beginning of the file, contains version of the format.
+ */
+static const char CHECKPOINT_MAGIC[] = "ANALYZER CHECKPOINT 6\n";
+
+/**
+ * @brief Constructor with initialization of members.
+ * @param p Path of the checkpoint file.
+ * @param config Text of the configuration of the analysis.
+ */
+Checkpoint::Checkpoint(std::string p, std::string config) :
+      path(p), runsPath(p + ".runs"), configText(config), savedRuns(0), runsSize(0) {
+}
+
+/**
+ * @brief Default destructor.
+ */
+Checkpoint::~Checkpoint() {
+}
+
+/**
+ * @brief Restores state of the analysis from the checkpoint file.
+ * @param runs Store where plans of the saved runs are added.
+ * @param position Position of the scheduler is stored here.
+ * @param aggregator Aggregator whose graph is replaced by the saved one.
+ * @return @a false if there is no checkpoint file (analysis must start from beginning),
+ * otherwise @a true.
+ * @throws ConfigurationException In case the file is not valid or it belongs to another
+ * configuration.
+ */
+bool Checkpoint::restore(RunStore *runs, std::string &position,
+      Aggregator *aggregator) {
+   std::ifstream file(path, std::ifstream::in | std::ifstream::binary);
+   if (!file.is_open())
+      return false;
+   std::stringstream content;
+   content << file.rdbuf();
+   file.close();
+   std::string data = content.str();
+
+   size_t pos = sizeof(CHECKPOINT_MAGIC) - 1;
+   if (data.compare(0, pos, CHECKPOINT_MAGIC) != 0)
+      throw ConfigurationException("Invalid checkpoint file");
+   if (readRecord(data, pos) != configText)
+      throw ConfigurationException("Checkpoint belongs to another configuration");
+   position = readRecord(data, pos);
+   std::string graph = readRecord(data, pos);
+   uint32_t runsCnt;
+   std::string runsCntRecord = readRecord(data, pos);
+   uint64_t size;
+   std::string sizeRecord = readRecord(data, pos);
+   if (runsCntRecord.size() != sizeof(runsCnt) || sizeRecord.size() != sizeof(size))
+      throw ConfigurationException("Invalid checkpoint file");
+   memcpy(&runsCnt, runsCntRecord.data(), sizeof(runsCnt));
+   memcpy(&size, sizeRecord.data(), sizeof(size));
+
+   // Only runs of the complete checkpoint are read, runs appended later are ignored
+   std::ifstream runsFile(runsPath, std::ifstream::in | std::ifstream::binary);
+   if (!runsFile.is_open())
+      throw ConfigurationException("Invalid checkpoint file");
+   std::string runsData(size, '\0');
+   if (!runsFile.read(&runsData[0], size))
+      throw ConfigurationException("Invalid checkpoint file");
+   runsFile.close();
+
+   try {
+      pos = 0;
+      for (uint32_t i = 0; i < runsCnt; ++i) {
+         RunPlan run;
+         run.parse(readRecord(runsData, pos));
+         runs->add(run);
+      }
+      aggregator->parseGraph(graph);
+   } catch (ProtocolException &e) {
+      throw ConfigurationException("Invalid checkpoint file");
+   }
+   if (pos != size)
+      throw ConfigurationException("Invalid checkpoint file");
+   savedRuns = runsCnt;
+   runsSize = size;
+   return true;
+}
+
+/**
+ * @brief Saves state of the analysis.
+ * Must be called when all units passed to aggregator have been merged.
+ * @param runs Plans of runs saved by controller.
+ * @param position Position of the scheduler after the last merged unit.
+ * @param aggregator Aggregator with the graph.
+ * @throws ConfigurationException In case the file can not be written (with description of
+ * the failed operation).
+ */
+void Checkpoint::save(RunStore *runs, const std::string &position,
+      Aggregator *aggregator) {
+   // Runs must be on disk before the checkpoint which refers to them
+   uint64_t size = appendRuns(runs);
+   uint32_t runsCnt = runs->getSize();
+
+   std::string data(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) - 1);
+   writeRecord(data, configText);
+   writeRecord(data, position);
+   writeRecord(data, aggregator->composeGraph());
+   writeRecord(data, std::string(reinterpret_cast<char *>(&runsCnt), sizeof(runsCnt)));
+   writeRecord(data, std::string(reinterpret_cast<char *>(&size), sizeof(size)));
+   replaceFile(path, data);
+   savedRuns = runsCnt;
+   runsSize = size;
+}
+
+/**
+ * @brief Removes the checkpoint file and the file with runs.
+ */
+void Checkpoint::remove() {
+   unlink(path.c_str());
+   unlink(runsPath.c_str());
+   savedRuns = 0;
+   runsSize = 0;
+}
+
+/**
+ * @brief Appends plans of runs saved since the last checkpoint to the file with runs.
+ * Runs after the last complete checkpoint are truncated first.
+ * @param runs Plans of runs saved by controller.
+ * @return New size of the file with runs.
+ * @throws ConfigurationException In case the file can not be written.
+ */
+uint64_t Checkpoint::appendRuns(RunStore *runs) {
+   std::string data;
+   for (uint32_t i = savedRuns; i < runs->getSize(); ++i) {
+      writeRecord(data, runs->getText(i));
+   }
+
+   int fd = open(runsPath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+   if (fd < 0)
+      throw error("Opening", runsPath);
+   if (ftruncate(fd, runsSize) != 0) {
+      ConfigurationException e = error("Truncating", runsPath);
+      close(fd);
+      throw e;
+   }
+   const char *buf = data.data();
+   size_t left = data.size();
+   off_t offset = runsSize;
+   while (left > 0) {
+      ssize_t res = pwrite(fd, buf, left, offset);
+      if (res < 0) {
+         ConfigurationException e = error("Writing", runsPath);
+         close(fd);
+         throw e;
+      }
+      buf += res;
+      left -= res;
+      offset += res;
+   }
+   if (fsync(fd) != 0) {
+      ConfigurationException e = error("Synchronizing", runsPath);
+      close(fd);
+      throw e;
+   }
+   if (close(fd) != 0)
+      throw error("Closing", runsPath);
+   return runsSize + data.size();
+}
+
+/**
+ * @brief Writes whole file under temporary name and renames it.
+ * @param file Path of the file.
+ * @param data Content of the file.
+ * @throws ConfigurationException In case the file can not be written.
+ */
+void Checkpoint::replaceFile(const std::string &file, const std::string &data) {
+   // Previous file is replaced only after the new one is completely on disk
+   std::string tmpPath = file + ".tmp";
+   int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+   if (fd < 0)
+      throw error("Opening", tmpPath);
+   const char *buf = data.data();
+   size_t left = data.size();
+   while (left > 0) {
+      ssize_t res = write(fd, buf, left);
+      if (res < 0)
+         break;
+      buf += res;
+      left -= res;
+   }
+   if (left > 0 || fsync(fd) != 0) {
+      ConfigurationException e = error(left > 0 ? "Writing" : "Synchronizing", tmpPath);
+      close(fd);
+      unlink(tmpPath.c_str());
+      throw e;
+   }
+   if (close(fd) != 0) {
+      ConfigurationException e = error("Closing", tmpPath);
+      unlink(tmpPath.c_str());
+      throw e;
+   }
+   if (rename(tmpPath.c_str(), file.c_str()) != 0) {
+      ConfigurationException e = error("Renaming " + tmpPath + " to", file);
+      unlink(tmpPath.c_str());
+      throw e;
+   }
+}
+
+/**
+ * @brief Creates exception describing failure of system call.
+ * @param operation Description of failed operation.
+ * @param file Path of the file.
+ * @return Exception with the operation, file and description of errno.
+ */
+ConfigurationException Checkpoint::error(const std::string &operation, const std::string &file) {
+   return ConfigurationException(operation + " checkpoint file " + file + " failed: "
+         + strerror(errno));
+}
+
+/**
+ * @brief Appends record to the data of the file.
+ * @param data Data of the file.
+ * @param record Record to be appended.
+ */
+void Checkpoint::writeRecord(std::string &data, const std::string &record) {
+   uint32_t size = record.size();
+   data.append(reinterpret_cast<char *>(&size), sizeof(size));
+   data.append(record);
+}
+
+/**
+ * @brief Reads record from the data of the file.
+ * @param data Data of the file.
+ * @param pos Position of the record in data, moved after the record.
+ * @return Record read.
+ * @throws ConfigurationException In case the data does not contain the record.
+ */
+std::string Checkpoint::readRecord(const std::string &data, size_t &pos) {
+   uint32_t size;
+   if (pos + sizeof(size) > data.size())
+      throw ConfigurationException("Invalid checkpoint file");
+   memcpy(&size, data.data() + pos, sizeof(size));
+   pos += sizeof(size);
+   if (pos + size > data.size())
+      throw ConfigurationException("Invalid checkpoint file");
+   pos += size;
+   return data.substr(pos - size, size);
+}
@@ -0,0 +1,128 @@
+/**
+ * @file Checkpoint.h
+ *
+ * @brief Checkpoint class.
+ *
+ * Contains definition of the class Checkpoint, which saves state of the analysis into a file, so
+ * that interrupted analysis can be resumed.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include "RunStore.h"
+#include "Aggregator/Aggregator.h"
+#include "Exceptions/ConfigurationException.h"
+
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Saved state of the analysis.
+ *
+ * Used when option checkpoint is set. State of the analysis consists of plans of the runs saved
+ * by controller, position of the scheduler after the last merged unit and the graph (including
+ * state of the jump detector) created from all merged units. Runs that have not inserted any node
+ * are not saved, but they may have changed the graph (e.g. set a node final), so the graph can not
+ * be created again from the saved runs and it is saved as well.
+ *
+ * Plans of runs are only added during the analysis, so they are appended to a separate file
+ * (path of the checkpoint with suffix ".runs") and each checkpoint writes only the runs saved
+ * since the previous one. The checkpoint file contains magic number with version of the format
+ * followed by binary records, each with length and data: configuration text, position, graph,
+ * number of runs and size of the file with runs. Plans of runs are records of the same form
+ * (in form created by RunPlan::compose). The checkpoint file is written under temporary name and
+ * renamed after the runs are on disk, so interrupted checkpoint never damages the previous one:
+ * runs appended after the last complete checkpoint are ignored and truncated when the next
+ * checkpoint is saved.
+ */
+class Checkpoint {
+public:
+   /**
+    * @brief Constructor with initialization of members.
+    * @param p Path of the checkpoint file.
+    * @param config Text of the configuration of the analysis.
+    */
+   Checkpoint(std::string p, std::string config);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~Checkpoint();
+
+   /**
+    * @brief Restores state of the analysis from the checkpoint file.
+    * @param runs Store where plans of the saved runs are added.
+    * @param position Position of the scheduler is stored here.
+    * @param aggregator Aggregator whose graph is replaced by the saved one.
+    * @return @a false if there is no checkpoint file (analysis must start from beginning),
+    * otherwise @a true.
+    * @throws ConfigurationException In case the file is not valid or it belongs to another
+    * configuration.
+    */
+   bool restore(RunStore *runs, std::string &position, Aggregator *aggregator);
+   /**
+    * @brief Saves state of the analysis.
+    * Must be called when all units passed to aggregator have been merged.
+    * @param runs Plans of runs saved by controller.
+    * @param position Position of the scheduler after the last merged unit.
+    * @param aggregator Aggregator with the graph.
+    * @throws ConfigurationException In case the file can not be written (with description of
+    * the failed operation).
+    */
+   void save(RunStore *runs, const std::string &position, Aggregator *aggregator);
+   /**
+    * @brief Removes the checkpoint file and the file with runs.
+    */
+   void remove();
+protected:
+   std::string path; /**< Path of the checkpoint file */
+   std::string runsPath; /**< Path of the file with plans of runs */
+   std::string configText; /**< Text of the configuration of the analysis */
+   uint32_t savedRuns; /**< Number of runs in the last complete checkpoint */
+   uint64_t runsSize; /**< Size of the file with runs in the last complete checkpoint */
+private:
+   /**
+    * @brief Appends plans of runs saved since the last checkpoint to the file with runs.
+    * Runs after the last complete checkpoint are truncated first.
+    * @param runs Plans of runs saved by controller.
+    * @return New size of the file with runs.
+    * @throws ConfigurationException In case the file can not be written.
+    */
+   uint64_t appendRuns(RunStore *runs);
+   /**
+    * @brief Writes whole file under temporary name and renames it.
+    * @param file Path of the file.
+    * @param data Content of the file.
+    * @throws ConfigurationException In case the file can not be written.
+    */
+   static void replaceFile(const std::string &file, const std::string &data);
+   /**
+    * @brief Creates exception describing failure of system call.
+    * @param operation Description of failed operation.
+    * @param file Path of the file.
+    * @return Exception with the operation, file and description of errno.
+    */
+   static ConfigurationException error(const std::string &operation, const std::string &file);
+   /**
+    * @brief Appends record to the data of the file.
+    * @param data Data of the file.
+    * @param record Record to be appended.
+    */
+   static void writeRecord(std::string &data, const std::string &record);
+   /**
+    * @brief Reads record from the data of the file.
+    * @param data Data of the file.
+    * @param pos Position of the record in data, moved after the record.
+    * @return Record read.
+    * @throws ConfigurationException In case the data does not contain the record.
+    */
+   static std::string readRecord(const std::string &data, size_t &pos);
+};
+
+#endif /* CHECKPOINT_H_ */
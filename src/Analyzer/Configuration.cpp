@@ -17,29 +17,41 @@
 #include <istream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <thread>
+#include <cstdlib>
+#include <unistd.h>
 
 /**
  * @brief Default constructor.
  * Creates empty configuration object.
  */
 Configuration::Configuration() :
-      help(false), initMsg(NULL), subroutine(0) {
+      help(false), initMsg(NULL), firstInitMsg(NULL), prelaunch(true), incremental(false),
+      minimize(false), resume(false), interval(60), memory(0), graphDir("/var/tmp"), traces(0),
+      jumps("window"),
+      subroutine(0), workers(1) {
    initMsg = new InitialMsg(OPTION);
 }
 
 /**
  * @brief Default destructor.
- * Deletes initial message, which is created dynamically.
+ * Deletes initial messages, which are created dynamically.
  */
 Configuration::~Configuration() {
    delete initMsg;
+   delete firstInitMsg;
 }
 
 /**
  * @brief Parses input configuration file.
  * Parses command line parameters, where the configuration file destination should be specified.
- * Then reads this file line by line, each line contains one configuration option in form:
- * @verbatim <option> = <value>@endverbatim
+ * Then reads this file line by line (see ::parseText).
+ * If the analyzer is started as worker of a coordinator, only the coordinator address is stored,
+ * configuration is received from the coordinator later. Similarly, only the address (or manifest)
+ * and number of workers is stored if the analyzer is started as daemon (or in batch mode). If a job
+ * is submitted to daemon, the configuration file is read, but not parsed (it is parsed by
+ * the daemon).
  * @param argc Number of command line parameters (argument of function main()).
  * @param argv Array of command line parameters (argument of function main()).
  * @throws ConfigurationException In case of invalid command line parameters or configuraiton
@@ -52,41 +64,41 @@ void Configuration::parse(int argc, char **argv) {
          help = true;
       }
       else {
-         // Open configuration file
-         std::ifstream configFile;
-         configFile.open(arg, std::ifstream::in);
-         if (!configFile.is_open())
-            // Open failure
-            throw ConfigurationException("Error opening configuration file");
-
-         std::string line;
-         // Read config file line by line
-         while (std::getline(configFile, line)) {
-            if (line[0] != '#') { // hash starts comment
-               std::istringstream isLine(line);
-               std::string option;
-               // Get part of line before '='
-               if (std::getline(isLine, option, '=')) {
-                  std::string value;
-                  // Get part of line after '='
-                  if (std::getline(isLine, value)) {
-                     // Get rid of trailing spaces in option name
-                     size_t pos = option.find_last_not_of(" ");
-                     if (pos != std::string::npos)
-                        option.erase(pos + 1);
-                     // Get rid of leading spaces in value string
-                     pos = value.find_first_not_of(" ");
-                     value.erase(0, pos);
-                     // Parse option value
-                     setOption(option, value);
-                  }
-                  else
-                     throw ConfigurationException("Incorrect configuration file syntax");
-               }
-               else
-                  throw ConfigurationException("Incorrect configuration file syntax");
-            }
-         }
+         parseText(readFile(arg, std::vector<std::string>()));
+      }
+   }
+   else if (argc == 3 && std::string(argv[1]) == "--resume") {
+      resume = true;
+      parseText(readFile(argv[2], std::vector<std::string>()));
+      if (checkpoint.empty())
+         throw ConfigurationException("Resuming analysis requires option checkpoint");
+   }
+   else if (argc == 3 && std::string(argv[1]) == "--worker") {
+      workerAddress = argv[2];
+   }
+   else if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--daemon") {
+      daemonAddress = argv[2];
+      // Daemon uses all processors by default
+      workers = std::max(1u, std::thread::hardware_concurrency());
+      if (argc == 4) {
+         std::stringstream ss(argv[3]);
+         if (!(ss >> workers) || workers <= 0)
+            throw ConfigurationException("Number of workers must be greater than 0");
+      }
+   }
+   else if (argc >= 4 && std::string(argv[1]) == "--submit") {
+      submitAddress = argv[2];
+      // Daemon has another working directory, so relative paths of the client are resolved here
+      text = absolutePaths(readFile(argv[3], std::vector<std::string>(argv + 4, argv + argc)));
+   }
+   else if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--batch") {
+      batchManifest = argv[2];
+      // Batch uses all processors by default
+      workers = std::max(1u, std::thread::hardware_concurrency());
+      if (argc == 4) {
+         std::stringstream ss(argv[3]);
+         if (!(ss >> workers) || workers <= 0)
+            throw ConfigurationException("Number of workers must be greater than 0");
       }
    }
    else
@@ -94,6 +106,80 @@ void Configuration::parse(int argc, char **argv) {
       throw ConfigurationException("Wrong number of parameters specified");
 }
 
+/**
+ * @brief Reads text of configuration file.
+ * @param filename Name of the configuration file.
+ * @param program Tested program with parameters which replaces option program of the file (if it is
+ * not empty).
+ * @return Text of the configuration.
+ * @throws ConfigurationException In case the file can not be opened.
+ */
+std::string Configuration::readFile(std::string filename, std::vector<std::string> program) {
+   std::ifstream configFile;
+   configFile.open(filename, std::ifstream::in);
+   if (!configFile.is_open())
+      // Open failure
+      throw ConfigurationException("Error opening configuration file");
+
+   std::stringstream configText;
+   configText << configFile.rdbuf();
+   std::string result = configText.str();
+   // Last program option is used, so appended one overrides the one from configuration file
+   if (!program.empty()) {
+      if (!result.empty() && result[result.size() - 1] != '\n')
+         result += "\n";
+      result += "program =";
+      for (auto &arg : program)
+         result += " " + arg;
+      result += "\n";
+   }
+   return result;
+}
+
+/**
+ * @brief Parses configuration text.
+ * Reads the text line by line, each line contains one configuration option in form:
+ * @verbatim <option> = <value>@endverbatim
+ * After all options are read, initial message for the first run and arguments of tested program
+ * are created.
+ * @param t Text of the configuration (content of configuration file).
+ * @throws ConfigurationException In case of invalid configuraiton syntax.
+ */
+void Configuration::parseText(std::string t) {
+   text = t;
+   std::istringstream configFile(text);
+   std::string line;
+   // Read config file line by line
+   while (std::getline(configFile, line)) {
+      if (line[0] != '#') { // hash starts comment
+         std::istringstream isLine(line);
+         std::string option;
+         // Get part of line before '='
+         if (std::getline(isLine, option, '=')) {
+            std::string value;
+            // Get part of line after '='
+            if (std::getline(isLine, value)) {
+               // Get rid of trailing spaces in option name
+               size_t pos = option.find_last_not_of(" ");
+               if (pos != std::string::npos)
+                  option.erase(pos + 1);
+               // Get rid of leading spaces in value string
+               pos = value.find_first_not_of(" ");
+               value.erase(0, pos);
+               // Parse option value
+               setOption(option, value);
+            }
+            else
+               throw ConfigurationException("Incorrect configuration file syntax");
+         }
+         else
+            throw ConfigurationException("Incorrect configuration file syntax");
+      }
+   }
+   createFirstInitMsg();
+   createProgramArgs();
+}
+
 /**
  * @brief Parses individual options.
  * Based on option name, parses its value and stores it in appropriate form to one of object
@@ -105,7 +191,8 @@ void Configuration::parse(int argc, char **argv) {
 void Configuration::setOption(std::string option, std::string value) {
    // Switch option name
    if (option == "program") {
-      // Program name and parameters are divided by white spaces
+      // Program name and parameters are divided by white spaces (last program option is used)
+      testedProgram.clear();
       std::istringstream isProgram(value);
       std::string arg;
       while (isProgram >> arg) {
@@ -176,6 +263,94 @@ void Configuration::setOption(std::string option, std::string value) {
       else
          throw ConfigurationException("Subroutine must be a number");
    }
+   else if (option == "jumps") {
+      // Jumps is simple string, its validation will be performed elsewhere
+      jumps = value;
+   }
+   else if (option == "workers") {
+      // Number of workers must be a number greater than 0
+      std::stringstream ss(value);
+      if (ss >> workers) {
+         if (workers <= 0)
+            throw ConfigurationException("Number of workers must be greater than 0");
+      }
+      else
+         throw ConfigurationException("Workers must be a number");
+   }
+   else if (option == "coordinator") {
+      // Address is simple string, its validation will be performed elsewhere
+      coordinator = value;
+   }
+   else if (option == "cache") {
+      // Cache directory is simple string, it is created when the analysis starts
+      cache = value;
+   }
+   else if (option == "checkpoint") {
+      // Checkpoint file is simple string, it is created when the analysis starts
+      checkpoint = value;
+   }
+   else if (option == "interval") {
+      // Interval is a number of seconds, 0 means checkpoint after each run
+      std::stringstream ss(value);
+      if (!(ss >> interval))
+         throw ConfigurationException("Interval must be a number");
+   }
+   else if (option == "memory") {
+      // Memory is a number of megabytes, 0 means the graph is kept in memory
+      std::stringstream ss(value);
+      if (!(ss >> memory))
+         throw ConfigurationException("Memory must be a number");
+   }
+   else if (option == "graphdir") {
+      // Directory is simple string, files of the graph are created in it when the analysis starts
+      graphDir = value;
+   }
+   else if (option == "traces") {
+      // Traces is a number of megabytes, 0 means the table of traces is not limited
+      std::stringstream ss(value);
+      if (!(ss >> traces))
+         throw ConfigurationException("Traces must be a number");
+   }
+   else if (option == "incremental") {
+      // Incremental is either yes or no
+      if (value == "yes" || value == "YES")
+         incremental = true;
+      else if (value == "no" || value == "NO")
+         incremental = false;
+      else
+         throw ConfigurationException("Incremental must be yes or no");
+   }
+   else if (option == "minimize") {
+      // Minimize is either yes or no
+      if (value == "yes" || value == "YES")
+         minimize = true;
+      else if (value == "no" || value == "NO")
+         minimize = false;
+      else
+         throw ConfigurationException("Minimize must be yes or no");
+   }
+   else if (option == "prelaunch") {
+      // Prelaunch is either yes or no
+      if (value == "yes" || value == "YES")
+         prelaunch = true;
+      else if (value == "no" || value == "NO")
+         prelaunch = false;
+      else
+         throw ConfigurationException("Prelaunch must be yes or no");
+   }
+   else if (option == "sandbox") {
+      // Sandbox is a list of paths divided by ',', which must be inside the working directory
+      sandbox.clear();
+      std::istringstream isSandbox(value);
+      std::string path;
+      while (std::getline(isSandbox, path, ',')) {
+         if (path.empty() || path[0] == '/' || path == ".." || path.compare(0, 3, "../") == 0
+               || path.find("/../") != std::string::npos)
+            throw ConfigurationException("Sandbox path " + path
+                  + " must be relative to working directory");
+         sandbox.push_back(path);
+      }
+   }
    else if (option == "output") {
       // Output type is simple string, its validation will be performed elsewhere
       output = value;
@@ -198,6 +373,23 @@ std::vector<std::string> Configuration::getProgram() {
    return testedProgram;
 }
 
+/**
+ * @brief Gets path of tested program executable.
+ * @return Absolute path of tested program (see ::createProgramArgs).
+ */
+const char *Configuration::getProgramPath() {
+   return programPath.c_str();
+}
+
+/**
+ * @brief Gets arguments of tested program.
+ * @return NULL-terminated array of tested program name and parameters, which can be passed to
+ * execve() or posix_spawn().
+ */
+char *const *Configuration::getProgramArgs() {
+   return &programArgs[0];
+}
+
 /**
  * @brief Gets initial message.
  * @return Pointer to the initial message created from configuration.
@@ -206,6 +398,14 @@ InitialMsg *Configuration::getInitMsg() {
    return initMsg;
 }
 
+/**
+ * @brief Gets initial message for the first run.
+ * @return Pointer to the initial message of the first run (see ::createFirstInitMsg).
+ */
+InitialMsg *Configuration::getFirstInitMsg() {
+   return firstInitMsg;
+}
+
 /**
  * @brief Gets list of variant groups.
  * @return Vector of variant group names.
@@ -238,6 +438,30 @@ unsigned Configuration::getSubroutine() {
    return subroutine;
 }
 
+/**
+ * @brief Gets type of jump detector.
+ * @return String with jump detector type.
+ */
+std::string Configuration::getJumps() {
+   return jumps;
+}
+
+/**
+ * @brief Gets number of workers executing runs of tested program in parallel.
+ * @return Number of workers.
+ */
+unsigned Configuration::getWorkers() {
+   return workers;
+}
+
+/**
+ * @brief Gets address where the coordinator accepts workers.
+ * @return Address of the coordinator or empty string if runs are executed locally.
+ */
+std::string Configuration::getCoordinator() {
+   return coordinator;
+}
+
 /**
  * @brief Gets output type.
  * @return String with output type.
@@ -254,6 +478,144 @@ std::string Configuration::getDestination() {
    return destination;
 }
 
+/**
+ * @brief Gets address of the coordinator the analyzer works for.
+ * @return Address given by --worker or empty string if the analyzer is not a worker.
+ */
+std::string Configuration::getWorkerAddress() {
+   return workerAddress;
+}
+
+/**
+ * @brief Gets address where the daemon accepts jobs.
+ * @return Address given by --daemon or empty string if the analyzer is not a daemon.
+ */
+std::string Configuration::getDaemonAddress() {
+   return daemonAddress;
+}
+
+/**
+ * @brief Gets address of the daemon the job is submitted to.
+ * @return Address given by --submit or empty string if no job is submitted.
+ */
+std::string Configuration::getSubmitAddress() {
+   return submitAddress;
+}
+
+/**
+ * @brief Gets directory of the run cache.
+ * @return Path of the directory or empty string if runs are not cached.
+ */
+std::string Configuration::getCache() {
+   return cache;
+}
+
+/**
+ * @brief Sets directory of the run cache if option cache is not given.
+ * Used by the daemon, so that jobs share its cache.
+ * @param d Path of the directory.
+ */
+void Configuration::setDefaultCache(std::string d) {
+   if (cache.empty())
+      cache = d;
+}
+
+/**
+ * @brief Gets file where the state of the analysis is saved.
+ * @return Path of the checkpoint file or empty string if no checkpoints are saved.
+ */
+std::string Configuration::getCheckpoint() {
+   return checkpoint;
+}
+
+/**
+ * @brief Gets minimal time between two checkpoints.
+ * @return Number of seconds.
+ */
+unsigned Configuration::getInterval() {
+   return interval;
+}
+
+/**
+ * @brief Gets maximal size of the memory used by the graph.
+ * @return Number of megabytes, 0 if the graph is kept in memory.
+ */
+unsigned Configuration::getMemory() {
+   return memory;
+}
+
+/**
+ * @brief Gets directory of files of the graph.
+ * @return Path of the directory (used only if memory of the graph is limited).
+ */
+std::string Configuration::getGraphDir() {
+   return graphDir;
+}
+
+/**
+ * @brief Gets maximal size of the memory used by traces for jump detection.
+ * @return Number of megabytes, 0 if the size is not limited.
+ */
+unsigned Configuration::getTraces() {
+   return traces;
+}
+
+/**
+ * @brief Checks if --resume was specified, thus analysis continues from the checkpoint.
+ * @return Value of ::resume.
+ */
+bool Configuration::checkResume() {
+   return resume;
+}
+
+/**
+ * @brief Checks whether runs of the previous analysis may be reused after tested program changes.
+ * @return @a true if incremental analysis is enabled.
+ */
+bool Configuration::checkIncremental() {
+   return incremental;
+}
+
+/**
+ * @brief Checks whether the graph is minimized before output.
+ * @return @a true if the graph is minimized.
+ */
+bool Configuration::checkMinimize() {
+   return minimize;
+}
+
+/**
+ * @brief Checks whether tested program is launched before its run is scheduled.
+ * @return @a true if next tested program is launched after end of each run.
+ */
+bool Configuration::checkPrelaunch() {
+   return prelaunch;
+}
+
+/**
+ * @brief Gets paths copied into sandbox of each run.
+ * @return Vector of paths relative to working directory (empty if no sandbox is used).
+ */
+std::vector<std::string> Configuration::getSandbox() {
+   return sandbox;
+}
+
+/**
+ * @brief Gets name of the manifest with jobs of the batch.
+ * @return File name given by --batch or empty string if the analyzer is not in batch mode.
+ */
+std::string Configuration::getBatchManifest() {
+   return batchManifest;
+}
+
+/**
+ * @brief Gets text of the configuration.
+ * @return Text the configuration was parsed from.
+ */
+std::string Configuration::getText() {
+   return text;
+}
+
 /**
  * @brief Checks if --help was specified, thus help should be printed.
  * @return Value of ::help.
@@ -269,13 +631,149 @@ void Configuration::printHelp(){
    std::cout << helpMsg;
 }
 
+/**
+ * @brief Creates initial message for the first run.
+ * First initial message:
+ * - control list is empty (type is NONE)
+ * - notify list is union of control list and notify list from configuration init message
+ */
+void Configuration::createFirstInitMsg() {
+   delete firstInitMsg;
+   firstInitMsg = new InitialMsg(OPTION);
+   firstInitMsg->setControlType(NONE);
+
+   // If one of original types is ALL, union will be ALL
+   if (initMsg->getNotifyType() == ALL || initMsg->getControlType() == ALL) {
+      firstInitMsg->setNotifyType(ALL);
+   }
+   // If one of original types is INCLUDE, union will be include
+   else if (initMsg->getNotifyType() == INCLUDE || initMsg->getControlType() == INCLUDE) {
+      firstInitMsg->setNotifyType(INCLUDE);
+      // If notify type is INCLUDE, add all its functions to first init message notify list
+      if (initMsg->getNotifyType() == INCLUDE) {
+         for (auto fun : initMsg->getNotifyFunctions()) {
+            firstInitMsg->addNotifyFunction(fun);
+         }
+      }
+      // If control type is INCLUDE, add all its functions to first init message notify list
+      if (initMsg->getControlType() == INCLUDE) {
+         for (auto fun : initMsg->getControlFunctions()) {
+            firstInitMsg->addNotifyFunction(fun);
+         }
+      }
+   }
+   // Both original types are NONE, union is NONE
+   else {
+      firstInitMsg->setNotifyType(NONE);
+   }
+}
+
+/**
+ * @brief Creates arguments of tested program.
+ * Relative path of tested program is resolved against working directory, so that it is valid even
+ * if tested program is executed in a sandbox.
+ * @throws ConfigurationException In case no tested program is given.
+ */
+void Configuration::createProgramArgs() {
+   if (testedProgram.empty())
+      throw ConfigurationException("Tested program is not specified");
+
+   programPath = absolutePath(testedProgram[0]);
+   programArgs.clear();
+   for (auto &arg : testedProgram) {
+      programArgs.push_back(&arg[0]);
+   }
+   // Last member of the array must be NULL
+   programArgs.push_back(NULL);
+}
+
+/**
+ * @brief Makes paths in configuration text absolute.
+ * Used when the job is submitted to the daemon, whose working directory differs from the one of
+ * the client. Path of tested program and options destination, cache and checkpoint are resolved
+ * against working directory, other lines are kept.
+ * @param t Text of the configuration.
+ * @return Text of the configuration with absolute paths.
+ */
+std::string Configuration::absolutePaths(std::string t) {
+   std::istringstream configText(t);
+   std::ostringstream result;
+   std::string line;
+   while (std::getline(configText, line)) {
+      size_t eq = line.find('=');
+      if (line[0] != '#' && eq != std::string::npos) {
+         // Option and value are separated the same way as in ::parseText
+         std::string option = line.substr(0, eq);
+         size_t pos = option.find_last_not_of(" ");
+         if (pos != std::string::npos)
+            option.erase(pos + 1);
+         std::string value = line.substr(eq + 1);
+         value.erase(0, value.find_first_not_of(" "));
+         if (option == "program") {
+            // Only tested program is a path, its arguments are passed unchanged
+            size_t end = value.find_first_of(" \t");
+            line = option + " = " + absolutePath(value.substr(0, end))
+                  + (end != std::string::npos ? value.substr(end) : "");
+         }
+         else if (option == "destination" || option == "cache" || option == "checkpoint")
+            line = option + " = " + absolutePath(value);
+      }
+      result << line << "\n";
+   }
+   return result.str();
+}
+
+/**
+ * @brief Makes path absolute.
+ * @param path Path relative to working directory (or absolute path).
+ * @return Absolute path (or @a path if it is empty or working directory is not available).
+ */
+std::string Configuration::absolutePath(std::string path) {
+   if (path.empty() || path[0] == '/')
+      return path;
+   char *cwd = getcwd(NULL, 0);
+   if (cwd == NULL)
+      return path;
+   std::string result = std::string(cwd) + "/" + path;
+   free(cwd);
+   return result;
+}
+
 const std::string Configuration::helpMsg =
       "Program for dynamic analysis of a binary and creating its control-flow graph.\n"
       "Usage:\n"
-      "   analyzer (FILENAME|--help)\n"
+      "   analyzer (FILENAME|--help|--resume FILENAME|--worker ADDRESS|\n"
+      "             --daemon ADDRESS [WORKERS]|--submit ADDRESS FILENAME [PROGRAM...]|\n"
+      "             --batch MANIFEST [WORKERS])\n"
       "\n"
       "--help Prints this help.\n"
       "\n"
+      "--resume Continues analysis whose configuration is given in file FILENAME from its\n"
+      "         last checkpoint (see option checkpoint). Configuration must not be changed.\n"
+      "\n"
+      "--worker Connects to the coordinator at ADDRESS and executes runs for it.\n"
+      "\n"
+      "--daemon Waits for analysis jobs at ADDRESS and runs them concurrently using WORKERS\n"
+      "         shared workers (default is number of processors). Stopped by SIGINT or SIGTERM.\n"
+      "         Tested program of a job runs in working directory of the daemon. Jobs without\n"
+      "         option cache share a temporary cache of the daemon.\n"
+      "\n"
+      "--submit Submits analysis whose configuration is given in file FILENAME to the daemon\n"
+      "         at ADDRESS and waits for its end. If PROGRAM is given, it replaces option\n"
+      "         program of the configuration. Path of tested program and options destination,\n"
+      "         cache and checkpoint are made absolute before the job is submitted.\n"
+      "\n"
+      "--batch Analyzes all jobs listed in MANIFEST concurrently using WORKERS shared workers\n"
+      "        (default is number of processors) and prints summary of the jobs.\n"
+      "        Each line of MANIFEST contains job in form FILENAME [PROGRAM...] (see --submit),\n"
+      "        empty lines and lines starting with '#' are ignored. Jobs must have different\n"
+      "        destinations.\n"
+      "\n"
+      "ADDRESS is path of Unix socket (only the same user may connect) or tcp:HOST:PORT\n"
+      "of TCP socket. Without HOST, TCP socket uses loopback, \"tcp:*:PORT\" listens on\n"
+      "all interfaces. Peers of TCP sockets are not authenticated and they may execute\n"
+      "any program as the user running the analyzer, so use TCP only on trusted networks.\n"
+      "\n"
       "Otherwise starts analysis whose configuration is given in file FILENAME.\n"
       "\n"
       "Configuration file syntax:\n"
@@ -316,14 +814,84 @@ const std::string Configuration::helpMsg =
       "                possible values:\n"
       "                  name - calls are aggregated by function name\n"
       "                  base_param - calls are aggregated by function name and base parameter\n"
+      "                  name_return - calls are aggregated by function name and by success\n"
+      "                                of the call (error or not)\n"
       "\n"
       "   subroutine - minimal subroutine size (used for detecting jumps in tested program)\n"
       "                must be superior to 0, 1 means no jump detection\n"
       "\n"
+      "   jumps - algorithm of jump detection (default window)\n"
+      "           possible values:\n"
+      "              window - repetitions of the last subroutine size of calls are detected\n"
+      "              automaton - the longest repetition of calls of current run is detected\n"
+      "\n"
+      "   workers - number of runs of tested program executed in parallel (default 1)\n"
+      "             result does not depend on this number, but tested program must not\n"
+      "             interfere with its other instances (eg. by writing to same files)\n"
+      "             (see option sandbox)\n"
+      "\n"
+      "   cache - directory where runs are stored, later analyses of the same tested program\n"
+      "           (same executables, arguments, options and sandbox files) load the runs\n"
+      "           from it instead of executing tested program again\n"
+      "           runs depending on files outside the sandbox must not be cached\n"
+      "\n"
+      "   checkpoint - file where state of the analysis is saved periodically, so that\n"
+      "                interrupted analysis can be continued by --resume; the file is\n"
+      "                removed when the analysis ends\n"
+      "\n"
+      "   interval - minimal number of seconds between two checkpoints (default 60)\n"
+      "\n"
+      "   memory - maximal size of the graph in memory in megabytes; the graph is stored\n"
+      "            in temporary files (see graphdir) and only its parts used by the last\n"
+      "            runs are kept in memory (default 0, the whole graph is kept in memory)\n"
+      "\n"
+      "   graphdir - directory of temporary files of the graph when option memory is set\n"
+      "              (default /var/tmp)\n"
+      "\n"
+      "   traces - maximal size of the table of traces used for jump detection in\n"
+      "            megabytes; when the table is full, repetitions of new traces are not\n"
+      "            detected as jumps (default 0, not limited)\n"
+      "\n"
+      "   incremental - when tested program has changed since the last analysis with the\n"
+      "                 same cache and options, reuse cached runs of the last analysis\n"
+      "                 which change behavior of tested program before the first call\n"
+      "                 where the initial runs differ (default no, requires cache)\n"
+      "                 the change is assumed to affect only calls after that call, so\n"
+      "                 changed code reached only by the reused runs is not detected\n"
+      "                 possible values: yes, no\n"
+      "\n"
+      "   prelaunch - launch next tested program right after end of each run, so that its\n"
+      "               start overlaps with scheduling of the next run; tested program\n"
+      "               waits at its first call of tracked function (default yes)\n"
+      "               possible values: yes, no\n"
+      "\n"
+      "   sandbox - list of files and directories divided by ',' (relative to working\n"
+      "             directory), which are copied into a fresh directory (in /dev/shm if\n"
+      "             possible) for each run; tested program is executed in that directory,\n"
+      "             so changes it makes do not affect other runs\n"
+      "             example: sandbox = tst/02\n"
+      "\n"
+      "   coordinator - address where analyzer waits for worker processes and lets them\n"
+      "                 execute runs (instead of executing them itself)\n"
+      "                 possible values: path of Unix socket (only the same user may\n"
+      "                                  connect)\n"
+      "                                  tcp:HOST:PORT for TCP socket (loopback\n"
+      "                                  without HOST, all interfaces for tcp:*:PORT)\n"
+      "                 workers of TCP socket are not authenticated and their runs\n"
+      "                 are trusted\n"
+      "                 analysis starts after all workers (see option workers) connect\n"
+      "                 workers are started as \"analyzer --worker ADDRESS\" in the same\n"
+      "                 directory as the coordinator\n"
+      "\n"
       "   output - output type\n"
       "            possible values:\n"
       "              dot - source with graph for program dot\n"
       "              json - graph in JSON notation\n"
       "\n"
+      "   minimize - merge nodes of the output graph from which same sequences of calls\n"
+      "              follow (eg. common ends of runs); nodes on cycles of jumps are not\n"
+      "              merged (default no)\n"
+      "              possible values: yes, no\n"
+      "\n"
       "   destination - output file destination\n"
       "\n";
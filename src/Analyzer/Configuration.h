@@ -35,32 +35,71 @@ public:
    Configuration();
    /**
     * @brief Default destructor.
-    * Deletes initial message, which is created dynamically.
+    * Deletes initial messages, which are created dynamically.
     */
    virtual ~Configuration();
 
    /**
     * @brief Parses input configuration file.
     * Parses command line parameters, where the configuration file destination should be specified.
-    * Then reads this file line by line, each line contains one configuration option in form:
-    * @verbatim <option> = <value>@endverbatim
+    * Then reads this file line by line (see ::parseText).
+    * If the analyzer is started as worker of a coordinator, only the coordinator address is stored,
+    * configuration is received from the coordinator later. Similarly, only the address (or manifest)
+    * and number of workers is stored if the analyzer is started as daemon (or in batch mode). If a
+    * job is submitted to daemon, the configuration file is read, but not parsed (it is parsed by
+    * the daemon).
     * @param argc Number of command line parameters (argument of function main()).
     * @param argv Array of command line parameters (argument of function main()).
     * @throws ConfigurationException In case of invalid command line parameters or configuraiton
     * file syntax.
     */
    void parse(int argc, char **argv);
+   /**
+    * @brief Parses configuration text.
+    * Reads the text line by line, each line contains one configuration option in form:
+    * @verbatim <option> = <value>@endverbatim
+    * After all options are read, initial message for the first run and arguments of tested
+    * program are created.
+    * @param t Text of the configuration (content of configuration file).
+    * @throws ConfigurationException In case of invalid configuraiton syntax.
+    */
+   void parseText(std::string t);
+   /**
+    * @brief Reads text of configuration file.
+    * @param filename Name of the configuration file.
+    * @param program Tested program with parameters which replaces option program of the file (if
+    * it is not empty).
+    * @return Text of the configuration.
+    * @throws ConfigurationException In case the file can not be opened.
+    */
+   static std::string readFile(std::string filename, std::vector<std::string> program);
 
    /**
     * @brief Gets analyzed program name and parameters.
     * @return Vector of strings with program name and its parameters.
     */
    std::vector<std::string> getProgram();
+   /**
+    * @brief Gets path of tested program executable.
+    * @return Absolute path of tested program (see ::createProgramArgs).
+    */
+   const char *getProgramPath();
+   /**
+    * @brief Gets arguments of tested program.
+    * @return NULL-terminated array of tested program name and parameters, which can be passed to
+    * execve() or posix_spawn().
+    */
+   char *const *getProgramArgs();
    /**
     * @brief Gets initial message.
     * @return Pointer to the initial message created from configuration.
     */
    InitialMsg *getInitMsg();
+   /**
+    * @brief Gets initial message for the first run.
+    * @return Pointer to the initial message of the first run (see ::createFirstInitMsg).
+    */
+   InitialMsg *getFirstInitMsg();
    /**
     * @brief Gets list of variant groups.
     * @return Vector of variant group names.
@@ -81,6 +120,21 @@ public:
     * @return Minimal subroutine size.
     */
    unsigned getSubroutine();
+   /**
+    * @brief Gets type of jump detector.
+    * @return String with jump detector type.
+    */
+   std::string getJumps();
+   /**
+    * @brief Gets number of workers executing runs of tested program in parallel.
+    * @return Number of workers.
+    */
+   unsigned getWorkers();
+   /**
+    * @brief Gets address where the coordinator accepts workers.
+    * @return Address of the coordinator or empty string if runs are executed locally.
+    */
+   std::string getCoordinator();
    /**
     * @brief Gets output type.
     * @return String with output type.
@@ -91,6 +145,93 @@ public:
     * @return String containing path to output file.
     */
    std::string getDestination();
+   /**
+    * @brief Gets address of the coordinator the analyzer works for.
+    * @return Address given by --worker or empty string if the analyzer is not a worker.
+    */
+   std::string getWorkerAddress();
+   /**
+    * @brief Gets address where the daemon accepts jobs.
+    * @return Address given by --daemon or empty string if the analyzer is not a daemon.
+    */
+   std::string getDaemonAddress();
+   /**
+    * @brief Gets address of the daemon the job is submitted to.
+    * @return Address given by --submit or empty string if no job is submitted.
+    */
+   std::string getSubmitAddress();
+   /**
+    * @brief Gets directory of the run cache.
+    * @return Path of the directory or empty string if runs are not cached.
+    */
+   std::string getCache();
+   /**
+    * @brief Sets directory of the run cache if option cache is not given.
+    * Used by the daemon, so that jobs share its cache.
+    * @param d Path of the directory.
+    */
+   void setDefaultCache(std::string d);
+   /**
+    * @brief Gets file where the state of the analysis is saved.
+    * @return Path of the checkpoint file or empty string if no checkpoints are saved.
+    */
+   std::string getCheckpoint();
+   /**
+    * @brief Gets minimal time between two checkpoints.
+    * @return Number of seconds.
+    */
+   unsigned getInterval();
+   /**
+    * @brief Gets maximal size of the memory used by the graph.
+    * @return Number of megabytes, 0 if the graph is kept in memory.
+    */
+   unsigned getMemory();
+   /**
+    * @brief Gets directory of files of the graph.
+    * @return Path of the directory (used only if memory of the graph is limited).
+    */
+   std::string getGraphDir();
+   /**
+    * @brief Gets maximal size of the memory used by traces for jump detection.
+    * @return Number of megabytes, 0 if the size is not limited.
+    */
+   unsigned getTraces();
+   /**
+    * @brief Checks if --resume was specified, thus analysis continues from the checkpoint.
+    * @return Value of ::resume.
+    */
+   bool checkResume();
+   /**
+    * @brief Checks whether runs of the previous analysis may be reused after tested program
+    * changes.
+    * @return @a true if incremental analysis is enabled.
+    */
+   bool checkIncremental();
+   /**
+    * @brief Checks whether the graph is minimized before output.
+    * @return @a true if the graph is minimized.
+    */
+   bool checkMinimize();
+   /**
+    * @brief Checks whether tested program is launched before its run is scheduled.
+    * @return @a true if next tested program is launched after end of each run.
+    */
+   bool checkPrelaunch();
+   /**
+    * @brief Gets paths copied into sandbox of each run.
+    * @return Vector of paths relative to working directory (empty if no sandbox is used).
+    */
+   std::vector<std::string> getSandbox();
+   /**
+    * @brief Gets name of the manifest with jobs of the batch.
+    * @return File name given by --batch or empty string if the analyzer is not in batch mode.
+    */
+   std::string getBatchManifest();
+   /**
+    * @brief Gets text of the configuration.
+    * @return Text the configuration was parsed from.
+    */
+   std::string getText();
    /**
     * @brief Checks if --help was specified, thus help should be printed.
     * @return Value of ::help.
@@ -110,6 +251,15 @@ protected:
     * First item is the program destination, the rest are parameters.
     */
    std::vector<std::string> testedProgram;
+   /**
+    * @brief Absolute path of tested program executable.
+    */
+   std::string programPath;
+   /**
+    * @brief Arguments of tested program pointing to ::testedProgram, terminated by NULL.
+    * Created once per analysis, so they do not have to be built for each run.
+    */
+   std::vector<char *> programArgs;
    /**
     * @brief Initial message containing control and notify functions lists.
     *    - @b Notify list contains information which functions performing the analyzer will be
@@ -118,11 +268,76 @@ protected:
     *    able to affect.
     */
    InitialMsg *initMsg;
+   /**
+    * @brief Initial message for the first run.
+    * Nothing is controlled and all functions from notify and control lists are notified.
+    */
+   InitialMsg *firstInitMsg;
    /**
     * @brief List of variant groups specifying which variants will be used for affecting calls in tested
     * program.
     */
    std::vector<std::string> variants;
+   /**
+    * @brief Paths copied into sandbox of each run.
+    * Tested program is executed in a private copy of these paths.
+    */
+   std::vector<std::string> sandbox;
+   /**
+    * @brief Flag whether next tested program is launched after end of each run.
+    */
+   bool prelaunch;
+   /**
+    * @brief Flag whether runs of the previous analysis may be reused after tested program changes.
+    */
+   bool incremental;
+   /**
+    * @brief Flag whether equivalent nodes of the graph are merged in output.
+    */
+   bool minimize;
+   /**
+    * @brief If true, "--resume" option has been given and analysis continues from checkpoint.
+    */
+   bool resume;
+   /**
+    * @brief File where the state of the analysis is saved.
+    * If set, runs and position of the scheduler are saved into the file periodically.
+    */
+   std::string checkpoint;
+   /**
+    * @brief Minimal number of seconds between two checkpoints.
+    */
+   unsigned interval;
+   /**
+    * @brief Maximal size of the memory used by the graph in megabytes.
+    * If set, the graph is stored in temporary files and only its parts used last are kept in
+    * memory.
+    */
+   unsigned memory;
+   /**
+    * @brief Directory of files of the graph if its memory is limited.
+    * It should not be in memory (as /tmp often is), default is /var/tmp.
+    */
+   std::string graphDir;
+   /**
+    * @brief Maximal size of the memory used by the table of traces for jump detection in
+    * megabytes.
+    * If set, traces which do not fit into the table are not used for detecting jumps.
+    */
+   unsigned traces;
+   /**
+    * @brief Jump detector type to be used for analysis.
+    * Currently supported types:
+    *    - window (repetitions of the last subroutine size of calls are detected)
+    *    - automaton (the longest repetition of calls inserted in current run is detected)
+    */
+   std::string jumps;
+   /**
+    * @brief Directory of the run cache.
+    * If set, runs are stored into the directory and loaded from it instead of executing tested
+    * program.
+    */
+   std::string cache;
    /**
     * @brief Scheduler type to be used for analysis.
     * This type affects the strategy of controlling the flow of analyzed program in order
@@ -136,6 +351,8 @@ protected:
     * This defines when two calls are considered same, or different.
     * Currently supported types:
     *    - name (calls are distinguished by function name only)
+    *    - base_param (calls are distinguished by function name and base parameter value)
+    *    - name_return (calls are distinguished by function name and success of the call)
     */
    std::string aggregator;
    /**
@@ -145,6 +362,41 @@ protected:
     * If it is equal to 1, no jump detection will be performed.
     */
    int subroutine;
+   /**
+    * @brief Number of workers.
+    * Specifies how many runs of tested program may be executed in parallel.
+    */
+   int workers;
+   /**
+    * @brief Address of the coordinator.
+    * If set, runs are executed by worker processes connected to this address.
+    */
+   std::string coordinator;
+   /**
+    * @brief Address of the coordinator given by --worker.
+    * If set, the analyzer executes runs for the coordinator.
+    */
+   std::string workerAddress;
+   /**
+    * @brief Address given by --daemon.
+    * If set, the analyzer runs jobs submitted to this address.
+    */
+   std::string daemonAddress;
+   /**
+    * @brief Address given by --submit.
+    * If set, the configuration is submitted to the daemon at this address.
+    */
+   std::string submitAddress;
+   /**
+    * @brief Manifest given by --batch.
+    * If set, all jobs listed in the manifest are analyzed.
+    */
+   std::string batchManifest;
+   /**
+    * @brief Text the configuration was parsed from.
+    * It is sent by coordinator to its workers.
+    */
+   std::string text;
    /**
     * @brief Output type.
     * Currently supported types:
@@ -167,6 +419,35 @@ private:
     * @throws ConfigurationException In case of invalid configuration option or value.
     */
    void setOption(std::string option, std::string value);
+   /**
+    * @brief Creates initial message for the first run.
+    * First initial message:
+    * - control list is empty (type is NONE)
+    * - notify list is union of control list and notify list from configuration init message
+    */
+   void createFirstInitMsg();
+   /**
+    * @brief Creates arguments of tested program.
+    * Relative path of tested program is resolved against working directory, so that it is valid
+    * even if tested program is executed in a sandbox.
+    * @throws ConfigurationException In case no tested program is given.
+    */
+   void createProgramArgs();
+   /**
+    * @brief Makes paths in configuration text absolute.
+    * Used when the job is submitted to the daemon, whose working directory differs from the one
+    * of the client. Path of tested program and options destination, cache and checkpoint are
+    * resolved against working directory, other lines are kept.
+    * @param t Text of the configuration.
+    * @return Text of the configuration with absolute paths.
+    */
+   static std::string absolutePaths(std::string t);
+   /**
+    * @brief Makes path absolute.
+    * @param path Path relative to working directory (or absolute path).
+    * @return Absolute path (or @a path if it is empty or working directory is not available).
+    */
+   static std::string absolutePath(std::string path);
    /**
     * Help message string.
     */
@@ -0,0 +1,238 @@
+/**
+ * @file Connection.cpp
+ *
+ * Implementation of methods of the class Connection.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Connection.h"
+#include "Exceptions/SocketException.h"
+#include "Exceptions/SocketClosedException.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <cstring>
+#include <unistd.h>
+#include <errno.h>
+#include <sstream>
+#include <sys/stat.h>
+
+/**
+ * Prefix of addresses of TCP sockets.
+ */
+static const std::string TCP_PREFIX = "tcp:";
+/**
+ * Maximal length of a received message (configuration, unit or run).
+ */
+static const size_t MAX_MSG_SIZE = 256 << 20;
+
+/**
+ * @brief Constructor connecting to given address.
+ * @param address Address where the other side listens.
+ * @throws SocketException In case connecting fails.
+ */
+Connection::Connection(std::string address) :
+      fd(openSocket(address, false)) {
+}
+
+/**
+ * @brief Constructor with already connected socket.
+ * @param f Descriptor of the connected socket.
+ */
+Connection::Connection(int f) :
+      fd(f) {
+}
+
+/**
+ * @brief Default destructor.
+ * Closes the connection.
+ */
+Connection::~Connection() {
+   close(fd);
+}
+
+/**
+ * @brief Sends message through the connection.
+ * @param msg Message to be sent.
+ * @throws SocketClosedException In case the connection has been closed by other side.
+ * @throws SocketException In case an error occured during sending.
+ */
+void Connection::sendMsg(std::string msg) {
+   // Message is prefixed by its length
+   std::ostringstream data;
+   data << msg.size() << "\n" << msg;
+   std::string dataStr = data.str();
+   size_t sent = 0;
+   while (sent < dataStr.size()) {
+      ssize_t res = send(fd, dataStr.c_str() + sent, dataStr.size() - sent, MSG_NOSIGNAL);
+      if (res < 0) {
+         if (errno == EINTR)
+            continue;
+         if (errno == EPIPE || errno == ECONNRESET)
+            throw SocketClosedException();
+         throw SocketException("Sending the message failed");
+      }
+      sent += res;
+   }
+}
+
+/**
+ * @brief Receives message from the connection.
+ * @return Message received.
+ * @throws SocketClosedException In case the connection has been closed by other side.
+ * @throws SocketException In case an error occured during receiving.
+ */
+std::string Connection::recvMsg() {
+   size_t headerEnd;
+   size_t size = 0;
+   bool haveSize = false;
+   while (true) {
+      // Get message length from its header
+      if (!haveSize && (headerEnd = buffer.find('\n')) != std::string::npos) {
+         std::istringstream header(buffer.substr(0, headerEnd));
+         if (!(header >> size))
+            throw SocketException("Invalid message received");
+         // Peer must not make the connection allocate unlimited memory
+         if (size > MAX_MSG_SIZE)
+            throw SocketException("Message is too long");
+         buffer.erase(0, headerEnd + 1);
+         haveSize = true;
+      }
+      // Whole message received
+      if (haveSize && buffer.size() >= size) {
+         std::string msg = buffer.substr(0, size);
+         buffer.erase(0, size);
+         return msg;
+      }
+      char buf[4096];
+      ssize_t res = recv(fd, buf, sizeof(buf), 0);
+      if (res == 0)
+         throw SocketClosedException();
+      if (res < 0) {
+         if (errno == EINTR)
+            continue;
+         if (errno == ECONNRESET)
+            throw SocketClosedException();
+         throw SocketException("Receiving the message failed");
+      }
+      buffer.append(buf, res);
+   }
+}
+
+/**
+ * @brief Creates socket for given address.
+ * @param address Path of Unix socket or tcp:HOST:PORT of TCP socket. Empty HOST means
+ * loopback, listening socket is bound to all interfaces only if HOST is "*".
+ * @param listening If @a true, socket is bound to the address and listens on it, otherwise it
+ * is connected to the address.
+ * @return Descriptor of the socket.
+ * @throws SocketException In case the socket can not be created.
+ */
+int Connection::openSocket(std::string address, bool listening) {
+   int sock;
+   if (!isTcp(address)) {
+      // Unix socket
+      struct sockaddr_un saddr;
+      if (address.size() >= sizeof(saddr.sun_path))
+         throw SocketException("Socket path is too long");
+      saddr.sun_family = AF_UNIX;
+      strcpy(saddr.sun_path, address.c_str());
+      if ((sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+         throw SocketException("Creating socket failed");
+      if (listening) {
+         // Unlink previous socket created in the path
+         unlink(address.c_str());
+         // Only the user running the analyzer may connect (see also ::isTrusted)
+         if (bind(sock, (struct sockaddr *) &saddr, sizeof(saddr)) < 0
+               || chmod(address.c_str(), S_IRUSR | S_IWUSR) < 0 || listen(sock, SOMAXCONN) < 0) {
+            close(sock);
+            throw SocketException("Binding socket failed");
+         }
+      }
+      else if (connect(sock, (struct sockaddr *) &saddr, sizeof(saddr)) < 0) {
+         close(sock);
+         throw SocketException("Connecting to " + address + " failed");
+      }
+      return sock;
+   }
+
+   // TCP socket
+   size_t colon = address.rfind(':');
+   if (colon < TCP_PREFIX.size())
+      throw SocketException("Invalid address " + address);
+   std::string host = address.substr(TCP_PREFIX.size(), colon - TCP_PREFIX.size());
+   std::string port = address.substr(colon + 1);
+   struct addrinfo hints;
+   memset(&hints, 0, sizeof(hints));
+   hints.ai_family = AF_UNSPEC;
+   hints.ai_socktype = SOCK_STREAM;
+   // Without host, loopback is used (peers are not authenticated), "*" means all interfaces
+   bool anyHost = listening && host == "*";
+   hints.ai_flags = anyHost ? AI_PASSIVE : 0;
+   struct addrinfo *addrs;
+   if (getaddrinfo(host.empty() || anyHost ? NULL : host.c_str(), port.c_str(), &hints, &addrs)
+         != 0)
+      throw SocketException("Invalid address " + address);
+   // Use first address that works
+   sock = -1;
+   for (struct addrinfo *addr = addrs; addr != NULL; addr = addr->ai_next) {
+      if ((sock = socket(addr->ai_family, addr->ai_socktype | SOCK_CLOEXEC, addr->ai_protocol))
+            < 0)
+         continue;
+      int on = 1;
+      if (listening) {
+         setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+         if (bind(sock, addr->ai_addr, addr->ai_addrlen) == 0 && listen(sock, SOMAXCONN) == 0)
+            break;
+      }
+      else if (connect(sock, addr->ai_addr, addr->ai_addrlen) == 0) {
+         // Units and runs are small messages sent in turns
+         setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+         break;
+      }
+      close(sock);
+      sock = -1;
+   }
+   freeaddrinfo(addrs);
+   if (sock < 0)
+      throw SocketException((listening ? "Binding socket " : "Connecting to ") + address
+            + " failed");
+   return sock;
+}
+
+/**
+ * @brief Checks whether the address is address of TCP socket.
+ * @param address Address of the connection.
+ * @return @a true for tcp:HOST:PORT, @a false for path of Unix socket.
+ */
+bool Connection::isTcp(const std::string &address) {
+   return address.compare(0, TCP_PREFIX.size(), TCP_PREFIX) == 0;
+}
+
+/**
+ * @brief Checks whether accepted connection may be used.
+ * Connections of Unix sockets are accepted only from processes of the same user, connections
+ * of TCP sockets (selected explicitly) are always accepted.
+ * @param f Descriptor of the accepted socket.
+ * @return @a true if the peer is trusted.
+ */
+bool Connection::isTrusted(int f) {
+   struct sockaddr_storage local;
+   socklen_t localSize = sizeof(local);
+   if (getsockname(f, (struct sockaddr *) &local, &localSize) < 0)
+      return false;
+   if (local.ss_family != AF_UNIX)
+      return true;
+   struct ucred peer;
+   socklen_t peerSize = sizeof(peer);
+   return getsockopt(f, SOL_SOCKET, SO_PEERCRED, &peer, &peerSize) == 0 && peer.uid == geteuid();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file Connection.h
+ *
+ * @brief Connection class.
+ *
+ * Contains definition of the class Connection, which assures a stream connection between
+ * the coordinator and its worker processes.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef CONNECTION_H_
+#define CONNECTION_H_
+
+#include <string>
+
+/**
+ * @brief Stream connection between analyzer processes.
+ *
+ * Unlike Socket, which communicates with tested program, this connection is used for
+ * communication between analyzer processes (coordinator and its workers) and can transfer
+ * messages of any size. Each message is sent prefixed by its length.
+ * Address of the connection is either path of Unix socket or tcp:HOST:PORT of TCP socket.
+ * Peers are not authenticated by the protocol: the configuration is sent to any worker which
+ * connects, its runs are trusted and daemon executes any submitted program. Unix sockets are
+ * therefore used by default, they are accessible only by the user running the analyzer (see
+ * ::isTrusted). TCP must be selected explicitly and it listens on loopback unless HOST is given.
+ */
+class Connection {
+public:
+   /**
+    * @brief Constructor connecting to given address.
+    * @param address Address where the other side listens.
+    * @throws SocketException In case connecting fails.
+    */
+   Connection(std::string address);
+   /**
+    * @brief Constructor with already connected socket.
+    * @param f Descriptor of the connected socket.
+    */
+   Connection(int f);
+   /**
+    * @brief Default destructor.
+    * Closes the connection.
+    */
+   virtual ~Connection();
+
+   /**
+    * @brief Sends message through the connection.
+    * @param msg Message to be sent.
+    * @throws SocketClosedException In case the connection has been closed by other side.
+    * @throws SocketException In case an error occured during sending.
+    */
+   void sendMsg(std::string msg);
+   /**
+    * @brief Receives message from the connection.
+    * @return Message received.
+    * @throws SocketClosedException In case the connection has been closed by other side.
+    * @throws SocketException In case an error occured during receiving or the message is too
+    * long.
+    */
+   std::string recvMsg();
+
+   /**
+    * @brief Creates socket for given address.
+    * @param address Path of Unix socket or tcp:HOST:PORT of TCP socket. Empty HOST means
+    * loopback, listening socket is bound to all interfaces only if HOST is "*".
+    * @param listening If @a true, socket is bound to the address and listens on it, otherwise it
+    * is connected to the address.
+    * @return Descriptor of the socket.
+    * @throws SocketException In case the socket can not be created.
+    */
+   static int openSocket(std::string address, bool listening);
+   /**
+    * @brief Checks whether the address is address of TCP socket.
+    * @param address Address of the connection.
+    * @return @a true for tcp:HOST:PORT, @a false for path of Unix socket.
+    */
+   static bool isTcp(const std::string &address);
+   /**
+    * @brief Checks whether accepted connection may be used.
+    * Connections of Unix sockets are accepted only from processes of the same user, connections
+    * of TCP sockets (selected explicitly) are always accepted.
+    * @param f Descriptor of the accepted socket.
+    * @return @a true if the peer is trusted.
+    */
+   static bool isTrusted(int f);
+protected:
+   int fd; /**< Descriptor of the connected socket */
+   std::string buffer; /**< Received data not processed yet */
+};
+
+#endif /* CONNECTION_H_ */
@@ -11,136 +11,231 @@
  */
 
 #include "Controller.h"
-#include "Tracer.h"
 #include "Scheduler/BFSScheduler.h"
+#include "Worker/LocalWorker.h"
+#include "Worker/RemoteWorker.h"
+#include "Worker/Coordinator.h"
 #include "Exceptions/ConfigurationException.h"
-#include "Aggregator/BaseParamAggregator.h"
+#include "Aggregator/LabelAggregator.h"
+#include "Aggregator/NameLabel.h"
+#include "Aggregator/BaseParamLabel.h"
+#include "Aggregator/ReturnLabel.h"
+
+#include <iostream>
+#include <sstream>
+#include <unistd.h>
 
 /**
  * @brief Constructor with initialization of members.
- * Gets the configuration and creates socket, controller and aggregator according to the options.
+ * Gets the configuration and creates scheduler, aggregator and pool of workers according to
+ * the options.
  * @param c Configuration of the analyzer.
+ * @param pool Pool of workers shared with other analyses (if NULL, controller creates its own
+ * pool).
  */
-Controller::Controller(Configuration *c) :
-      completed(false), configuration(c) {
+Controller::Controller(Configuration *c, WorkerPool *pool) :
+      runs(new RunStore()), workerPool(pool), runCache(NULL), checkpoint(NULL),
+      ownPool(pool == NULL), configuration(c) {
+
+   // Create cache of runs if it is used
+   if (!configuration->getCache().empty())
+      runCache = new RunCache(configuration->getCache(), configuration);
+   else if (configuration->checkIncremental())
+      throw ConfigurationException("Incremental analysis requires option cache");
 
-   // Create new socket
-   socket = new Socket("/tmp/analyserSocket");
+   // Create checkpoint of the analysis if it is used
+   if (!configuration->getCheckpoint().empty())
+      checkpoint = new Checkpoint(configuration->getCheckpoint(), configuration->getText());
 
    // Create new scheduler according to type specified in configuration
    std::string schedType = configuration->getScheduler();
    if (schedType == "bfs")
-      scheduler = new BFSScheduler(this, configuration->getVariants());
+      scheduler = new BFSScheduler(this, configuration->getVariants(),
+            configuration->getInitMsg());
    else
       throw ConfigurationException("Unsupported scheduler type");
 
    // Create new aggregator according to type specified in configuration
    std::string aggregType = configuration->getAggregator();
+   size_t graphMemory = (size_t) configuration->getMemory() << 20;
+   std::string graphDir = configuration->getGraphDir();
+   size_t traceMemory = (size_t) configuration->getTraces() << 20;
+   std::string jumps = configuration->getJumps();
+   if (jumps != "window" && jumps != "automaton")
+      throw ConfigurationException("Unsupported jump detector type");
    if (aggregType == "name")
-      aggregator = new Aggregator(configuration->getSubroutine(), configuration->getDestination());
+      aggregator = new LabelAggregator<NameLabel>(configuration->getSubroutine(), jumps,
+            configuration->getDestination(), graphMemory, graphDir, traceMemory);
    else if (aggregType == "base_param") {
-      aggregator = new BaseParamAggregator(configuration->getSubroutine(),
-            configuration->getDestination());
+      aggregator = new LabelAggregator<BaseParamLabel>(configuration->getSubroutine(), jumps,
+            configuration->getDestination(), graphMemory, graphDir, traceMemory);
+   }
+   else if (aggregType == "name_return") {
+      aggregator = new LabelAggregator<ReturnLabel>(configuration->getSubroutine(), jumps,
+            configuration->getDestination(), graphMemory, graphDir, traceMemory);
    }
    else
       throw ConfigurationException("Unsupported aggregator type");
+
+   // Run aggregator in its own thread
+   aggregatorThread = new AggregatorThread(aggregator);
+
+   // Shared pool is used
+   if (!ownPool)
+      return;
+
+   // Create workers
+   std::vector<Worker *> workers;
+   if (configuration->getCoordinator().empty()) {
+      // Runs are executed locally, each worker has its own named socket
+      for (unsigned i = 0; i < configuration->getWorkers(); ++i) {
+         workers.push_back(
+               new LocalWorker(
+                     "/tmp/analyserSocket." + std::to_string(getpid()) + "." + std::to_string(i)));
+      }
+   }
+   else {
+      // Runs are executed by worker processes
+      Coordinator coordinator(configuration->getCoordinator());
+      for (unsigned i = 0; i < configuration->getWorkers(); ++i) {
+         std::cerr << "Waiting for worker " << i + 1 << "/" << configuration->getWorkers()
+               << std::endl;
+         workers.push_back(new RemoteWorker(coordinator.acceptWorker()));
+      }
+   }
+   workerPool = new WorkerPool(workers);
 }
 
 /**
  * @brief Default destructor.
- * Destroys all dynamic objects created in constructor and also deletes all runs.
+ * Waits until workers finish units of the analysis. Destroys all dynamic objects created in
+ * constructor and also deletes all runs.
  */
 Controller::~Controller() {
-   delete socket;
+   // Units must not be executed after the controller is destroyed (pool may be shared)
+   for (auto unit : executing) {
+      try {
+         workerPool->wait(unit);
+      } catch (...) {
+         // Analysis has already failed
+      }
+      discardUnit(unit);
+   }
+   aggregatorThread->sync();
+   for (auto unit : merging) {
+      discardUnit(unit);
+   }
+   if (ownPool)
+      delete workerPool;
+   delete runCache;
+   delete checkpoint;
    delete scheduler;
+   delete aggregatorThread;
    delete aggregator;
-   for (auto trace : runs) {
-      delete trace;
-   }
+   delete runs;
 }
 
 /**
  * @brief Method controlling the process of analysis.
  * Main method where the whole analysis takes place.
  * At first it creates the first run with notification-only calls (normal behavior of the
- * analyzed program). After that other different runs are created in the cycle, which is
- * stopped by scheduler.
- * For each run, this method creates individual Tracer object, which is responsible for tracing
- * the analyzed program from beginning to the end. Tracer during its proceeding calls the
- * functions ::controlCall and ::notifyCall every time a call arrives.
+ * analyzed program). After that other different runs are created in the cycle, which ends when
+ * scheduler has no more units to execute.
+ * Units are executed by workers (see ::executeUnit). Executed units are passed to the
+ * aggregator in the order they were scheduled and the runs that inserted a new node into
+ * the graph are saved.
+ * If checkpoints are used, state of the analysis is saved periodically. Resumed analysis
+ * starts from the saved state instead of the first run.
  */
 void Controller::startAnalysis() {
-   // Get initial message from configuration
-   InitialMsg *initMsg = configuration->getInitMsg();
-
-   // First tracer
-   Tracer tracer(socket, this, configuration->getProgram());
-
-   // First initial message:
-   // - control list is empty (type is NONE)
-   // - notify list is union of control list and notify list from configuration init message
-   InitialMsg firstInitMsg(OPTION);
-   firstInitMsg.setControlType(NONE);
+   bool restored = false;
+   if (checkpoint != NULL) {
+      if (configuration->checkResume())
+         restored = restoreCheckpoint();
+      else
+         // State of previous analysis is discarded
+         checkpoint->remove();
+      lastCheckpoint = std::chrono::steady_clock::now();
+   }
 
-   // If one of original types is ALL, union will be ALL
-   if (initMsg->getNotifyType() == ALL || initMsg->getControlType() == ALL) {
-      firstInitMsg.setNotifyType(ALL);
+   if (!restored) {
+      // Get first run with notification-only calls (it is always saved)
+      std::cerr << "Initial tracing starts" << std::endl;
+      WorkUnit firstUnit;
+      workerPool->execute(this, &firstUnit);
+      workerPool->wait(&firstUnit);
+      RunFragment *firstFragment = firstUnit.getFragment();
+      aggregatorThread->addRun(firstFragment);
+      aggregatorThread->sync();
+      RunPlan firstPlan(firstFragment->getRun(), configuration->getInitMsg());
+      runs->add(firstPlan);
+      delete firstFragment->getRun();
+      delete firstFragment;
+      std::cerr << "Initial tracing ended" << std::endl;
    }
-   // If one of original types is INCLUDE, union will be include
-   else if (initMsg->getNotifyType() == INCLUDE || initMsg->getControlType() == INCLUDE) {
-      firstInitMsg.setNotifyType(INCLUDE);
-      // If notify type is INCLUDE, add all its functions to first init message notify list
-      if (initMsg->getNotifyType() == INCLUDE) {
-         for (auto fun : initMsg->getNotifyFunctions()) {
-            firstInitMsg.addNotifyFunction(fun);
+
+   if (runs->get(0)->getSize() != 0) {
+      // Workers get new unit immediately after finishing previous one
+      unsigned maxExecuting = 2 * workerPool->getSize();
+      // Position of the scheduler after the last unit saved by ::finishUnit
+      std::string position;
+      // Main program loop getting different flows until scheduler has no more units
+      while (true) {
+         // Save runs of merged units (scheduler may create new units from them)
+         while (!merging.empty() && merging.front()->getFragment()->isMerged()) {
+            position = merging.front()->getPosition();
+            finishUnit(merging.front());
+            merging.pop_front();
          }
-      }
-      // If control type is INCLUDE, add all its functions to first init message notify list
-      if (initMsg->getControlType() == INCLUDE) {
-         for (auto fun : initMsg->getControlFunctions()) {
-            firstInitMsg.addNotifyFunction(fun);
+         // Save state of the analysis, graph must contain exactly the saved units
+         if (checkpoint != NULL && std::chrono::steady_clock::now() - lastCheckpoint
+               >= std::chrono::seconds(configuration->getInterval())) {
+            aggregatorThread->sync();
+            while (!merging.empty()) {
+               position = merging.front()->getPosition();
+               finishUnit(merging.front());
+               merging.pop_front();
+            }
+            if (!position.empty())
+               checkpoint->save(runs, position, aggregator);
+            lastCheckpoint = std::chrono::steady_clock::now();
          }
-      }
-   }
-   // Both original types are NONE, union is NONE
-   else {
-      firstInitMsg.setNotifyType(NONE);
-   }
-
-   // Get first run
-   tracer.init(&firstInitMsg);
-   std::cerr << "Initial tracing starts" << std::endl;
-   runs.push_back(tracer.trace());
-   std::cerr << "Initial tracing ended" << std::endl;
-
-   if (runs[0]->getSize() != 0) {
-      // Main program loop getting different flows until it is stopped by scheduler
-      while (!completed) {
-         // Reset aggregator
-         aggregator->nextRun();
-         std::cerr << "Tracing starts" << std::endl;
-         // Create new Tracer and get new flow
-         Tracer tracer(socket, this, configuration->getProgram());
-         tracer.init(initMsg);
-         Run *run = tracer.trace();
-         // If the run is different from existing runs, add it into vector of runs
-         if (aggregator->nodeInserted()){
-            std::cerr << "Run saved" << std::endl;
-            runs.push_back(run);
+         // Pass new units to workers
+         WorkUnit *unit;
+         while (executing.size() < maxExecuting && (unit = scheduler->nextUnit()) != NULL) {
+            std::cerr << "Tracing starts" << std::endl;
+            if (checkpoint != NULL)
+               unit->setPosition(scheduler->getPosition());
+            workerPool->execute(this, unit);
+            executing.push_back(unit);
+         }
+         if (!executing.empty()) {
+            // Merge units into graph in the order they were scheduled
+            unit = executing.front();
+            executing.pop_front();
+            try {
+               workerPool->wait(unit);
+            } catch (...) {
+               discardUnit(unit);
+               throw;
+            }
+            merging.push_back(unit);
+            aggregatorThread->addRun(unit->getFragment());
+         }
+         else if (!merging.empty()) {
+            // Runs that are being merged may give new units
+            aggregatorThread->sync();
          }
-         // If the run is same as one of existing flows, delete it
          else
-            delete run;
-         scheduler->nextRun();
-         std::cerr << "Tracing ended" << std::endl;
+            break;
       }
-      // Reset aggregator once more in order to make last node final
-      aggregator->nextRun();
    }
+   // Wait until aggregation is finished before graph is used for output
+   aggregatorThread->sync();
 
-   // Close socket
-   socket->closeWelcomeSocket();
-
+   // Merge equivalent nodes of output graph
+   if (configuration->checkMinimize())
+      aggregator->minimize();
    // Print output graph from aggregator in format given in configuration file
    std::string output = configuration->getOutput();
    if (output == "dot")
@@ -149,59 +244,92 @@ void Controller::startAnalysis() {
       aggregator->printJson();
    else
       throw ConfigurationException("Unsupported output format");
+
+   // Finished analysis is not resumed
+   if (checkpoint != NULL)
+      checkpoint->remove();
+   // Next analysis reuses runs of this one
+   if (runCache != NULL)
+      runCache->finish();
 }
 
 /**
- * @brief Reaction to the message of type CONTROL.
- * Method called by tracer every time a message of type CONTROL arrives.
- * Is responsible for scheduling how the behavior of the call will be affected (calls Scheduler)
- * and aggregating the call to existing graph (calls Aggregator).
- * @param call The call which is to be controlled.
- * @param run Current run of the tested program.
- * @param callNum The number of current call in the current run of tested program.
- * @return Generated response to the CONTROL message in the form of OutboundMsg.
+ * @brief Executes one unit.
+ * Called by a thread of worker pool. Worker obtains the run of tested program and fragment for
+ * aggregator is created from it and stored in the unit.
+ * If runs are cached, the run is loaded from the cache if possible and new runs are stored into
+ * it.
+ * @param worker Worker executing the unit.
+ * @param unit Unit to be executed.
  */
-OutboundMsg *Controller::controlCall(Call *call, Run *run, unsigned callNum) {
-   // Schedule next call and get response to CONTROL message
-   OutboundMsg *msg = scheduler->scheduleCall(call, run, callNum);
-   // Insert new call into existing graph
-   aggregator->newNode(call);
-   // Return response
-   return msg;
+void Controller::executeUnit(Worker *worker, WorkUnit *unit) {
+   Run *run = runCache != NULL ? runCache->load(unit) : NULL;
+   if (run == NULL) {
+      run = worker->execute(unit, configuration);
+      if (runCache != NULL)
+         runCache->store(unit, run);
+   }
+   unit->setFragment(new RunFragment(run, aggregator));
 }
 
 /**
- * @brief Reaction to the message of type NOTIFY.
- * Method called by tracer every time a message of type NOTIFY arrives.
- * Is responsible for aggregating the call to existing graph (calls Aggregator) and informing
- * scheduler that such call has been performed.
- * @param call The call which is performed by tested program.
- * @param callNum The number of call in current run of tested program.
- * @return OutboundMsg of type ACK as it is only possible response to NOTIFY message.
+ * @brief Processes unit merged into the graph.
+ * If the run of the unit inserted a new node into the graph, its plan is saved. The run, unit
+ * and its fragment are deleted.
+ * @param unit Unit whose fragment has been merged.
  */
-OutboundMsg *Controller::notifyCall(Call *call, unsigned callNum) {
-   // Inform scheduler about performing next call
-   scheduler->notifCall(callNum);
-   // Insert new call into existing graph
-   aggregator->newNode(call);
-   // Return response (always ACK)
-   return new OutboundMsg(ACK);
+void Controller::finishUnit(WorkUnit *unit) {
+   RunFragment *fragment = unit->getFragment();
+   // If the run is different from existing runs, add its plan into vector of runs (calls of the
+   // run are not needed after it has been merged)
+   if (fragment->nodeInserted()) {
+      std::cerr << "Run saved" << std::endl;
+      RunPlan plan(fragment->getRun(), configuration->getInitMsg());
+      runs->add(plan);
+   }
+   delete fragment->getRun();
+   std::cerr << "Tracing ended" << std::endl;
+   delete fragment;
+   delete unit;
 }
 
 /**
- * @brief Get run from given index.
- * @param index Index of run.
- * @return Pointer to the run at given index.
+ * @brief Restores state of the analysis from the checkpoint.
+ * Saved runs and graph are loaded and the scheduler continues from the saved position.
+ * @return @a false if there is no checkpoint, otherwise @a true.
  */
-Run *Controller::getRun(unsigned index) {
-   return runs[index];
+bool Controller::restoreCheckpoint() {
+   std::string position;
+   // Aggregator thread does not access the graph, no fragment has been passed to it yet
+   if (!checkpoint->restore(runs, position, aggregator)) {
+      std::cerr << "No checkpoint found, analysis starts from beginning" << std::endl;
+      return false;
+   }
+   scheduler->setPosition(position);
+   std::cerr << "Analysis resumed with " << runs->getSize() << " runs" << std::endl;
+   return true;
 }
 
 /**
- * @brief Set the analysis is completed after finishing current run.
+ * @brief Deletes unit together with its fragment and run (if it has been executed).
+ * @param unit Unit to be deleted.
  */
-void Controller::setCompleted() {
-   completed = true;
+void Controller::discardUnit(WorkUnit *unit) {
+   RunFragment *fragment = unit->getFragment();
+   if (fragment != NULL) {
+      delete fragment->getRun();
+      delete fragment;
+   }
+   delete unit;
+}
+
+/**
+ * @brief Get run from given index.
+ * @param index Index of run.
+ * @return Pointer to the plan of the run at given index, valid until this method is called again.
+ */
+RunPlan *Controller::getRun(unsigned index) {
+   return runs->get(index);
 }
 
 /**
@@ -209,7 +337,16 @@ void Controller::setCompleted() {
  * @return Number of runs.
  */
 unsigned Controller::getRunsCnt() {
-   return runs.size();
+   return runs->getSize();
+}
+
+/**
+ * @brief Gets number of nodes in the graph.
+ * Must not be called before the analysis ends.
+ * @return Number of nodes.
+ */
+unsigned Controller::getNodesCnt() {
+   return aggregator->nodesCount();
 }
 
 /**
@@ -218,8 +355,8 @@ unsigned Controller::getRunsCnt() {
  */
 void Controller::printTraces() {
    std::cout << std::endl;
-   for (auto trace : runs) {
-      trace->print();
+   for (unsigned i = 0; i < runs->getSize(); ++i) {
+      runs->get(i)->print();
    }
    std::cout << std::endl;
 }
@@ -231,8 +368,24 @@ void Controller::printTraces() {
  */
 void Controller::printReport(){
    std::cerr << std::endl;
-   std::cerr << "Analysis successfuly terminated." << std::endl;
-   std::cerr << "Number of nodes in graph: " << aggregator->nodesCount() << std::endl;
-   std::cerr << "Number of different runs: " << runs.size() << std::endl;
+   std::cerr << getReport();
    std::cerr << std::endl;
 }
+
+/**
+ * @brief Creates report about analysis.
+ * @return Text of the report.
+ */
+std::string Controller::getReport() {
+   std::ostringstream report;
+   report << "Analysis successfuly terminated." << std::endl;
+   report << "Number of nodes in graph: " << aggregator->nodesCount() << std::endl;
+   report << "Number of different runs: " << runs->getSize() << std::endl;
+   if (runCache != NULL) {
+      report << "Number of runs loaded from cache: " << runCache->getHits() << std::endl;
+      if (configuration->checkIncremental())
+         report << "Number of runs reused from previous analysis: " << runCache->getReused()
+               << std::endl;
+   }
+   return report.str();
+}
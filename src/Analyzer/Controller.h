@@ -15,7 +15,6 @@
 #ifndef CONTROLLER_H_
 #define CONTROLLER_H_
 
-#include "Socket.h"
 #include "Run.h"
 #include "Call.h"
 #include "Parser/OutboundMsg.h"
@@ -23,28 +22,41 @@
 #include "Parser/InitialMsg.h"
 #include "Scheduler/Scheduler.h"
 #include "Aggregator/Aggregator.h"
+#include "Aggregator/AggregatorThread.h"
 #include "Configuration.h"
+#include "Worker/WorkerPool.h"
+#include "RunCache.h"
+#include "Checkpoint.h"
+#include "RunStore.h"
 
 #include <vector>
+#include <deque>
 #include <map>
+#include <chrono>
 
 /**
  * @brief Class for controlling the analysis,
  * Main class which serves for controlling the process of analysis. Also is responsible for
  * generating reaction to the calls that come from analyzed program.
- * Creates and saves individual program runs, calls scheduler and aggregator.
+ * Creates and saves individual program runs, calls scheduler and aggregator. Runs are executed by
+ * pool of workers in parallel, but their results are processed in the order they were scheduled,
+ * so the analysis result does not depend on the number of workers.
  */
 class Controller {
 public:
    /**
     * @brief Constructor with initialization of members.
-    * Gets the configuration and creates socket, controller and aggregator according to the options.
+    * Gets the configuration and creates scheduler, aggregator and pool of workers according to
+    * the options.
     * @param c Configuration of the analyzer.
+    * @param pool Pool of workers shared with other analyses (if NULL, controller creates its own
+    * pool).
     */
-   Controller(Configuration *c);
+   Controller(Configuration *c, WorkerPool *pool = NULL);
    /**
     * @brief Default destructor.
-    * Destroys all dynamic objects created in constructor and also deletes all runs.
+    * Waits until workers finish units of the analysis. Destroys all dynamic objects created in
+    * constructor and also deletes all runs.
     */
    virtual ~Controller();
 
@@ -52,50 +64,44 @@ public:
     * @brief Method controlling the process of analysis.
     * Main method where the whole analysis takes place.
     * At first it creates the first run with notification-only calls (normal behavior of the
-    * analyzed program). After that other different runs are created in the cycle, which is
-    * stopped by scheduler.
-    * For each run, this method creates individual Tracer object, which is responsible for tracing
-    * the analyzed program from beginning to the end. Tracer during its proceeding calls the
-    * functions ::controlCall and ::notifyCall every time a call arrives.
+    * analyzed program). After that other different runs are created in the cycle, which ends when
+    * scheduler has no more units to execute.
+    * Units are executed by workers (see ::executeUnit). Executed units are passed to the
+    * aggregator in the order they were scheduled and the runs that inserted a new node into
+    * the graph are saved.
+    * If checkpoints are used, state of the analysis is saved periodically. Resumed analysis
+    * starts from the saved state instead of the first run.
     */
    void startAnalysis();
    /**
-    * @brief Reaction to the message of type CONTROL.
-    * Method called by tracer every time a message of type CONTROL arrives.
-    * Is responsible for scheduling how the behavior of the call will be affected (calls Scheduler)
-    * and aggregating the call to existing graph (calls Aggregator).
-    * @param call The call which is to be controlled.
-    * @param run Current run of the tested program.
-    * @param callNum The number of current call in the current run of tested program.
-    * @return Generated response to the CONTROL message in the form of OutboundMsg.
-    */
-   OutboundMsg *controlCall(Call *call, Run *run, unsigned callNum);
-   /**
-    * @brief Reaction to the message of type NOTIFY.
-    * Method called by tracer every time a message of type NOTIFY arrives.
-    * Is responsible for aggregating the call to existing graph (calls Aggregator) and informing
-    * scheduler that such call has been performed.
-    * @param call The call which is performed by tested program.
-    * @param callNum The number of call in current run of tested program.
-    * @return OutboundMsg of type ACK as it is only possible response to NOTIFY message.
-    */
-   OutboundMsg *notifyCall(Call *call, unsigned callNum);
+    * @brief Executes one unit.
+    * Called by a thread of worker pool. Worker obtains the run of tested program and fragment for
+    * aggregator is created from it and stored in the unit.
+    * If runs are cached, the run is loaded from the cache if possible and new runs are stored into
+    * it.
+    * @param worker Worker executing the unit.
+    * @param unit Unit to be executed.
+    */
+   void executeUnit(Worker *worker, WorkUnit *unit);
 
    /**
     * @brief Get run from given index.
     * @param index Index of run.
-    * @return Pointer to the run at given index.
-    */
-   Run *getRun(unsigned index);
-   /**
-    * @brief Set the analysis is completed after finishing current run.
+    * @return Pointer to the plan of the run at given index, valid until this method is called
+    * again.
     */
-   void setCompleted();
+   RunPlan *getRun(unsigned index);
    /**
     * @brief Gets number of different runs already obtained.
     * @return Number of runs.
     */
    unsigned getRunsCnt();
+   /**
+    * @brief Gets number of nodes in the graph.
+    * Must not be called before the analysis ends.
+    * @return Number of nodes.
+    */
+   unsigned getNodesCnt();
    /**
     * @brief Prints traces to standard output.
     * @warning For testing purposes only.
@@ -106,22 +112,48 @@ public:
     * Called at the end of analysis.
     */
    void printReport();
+   /**
+    * @brief Creates report about analysis.
+    * @return Text of the report.
+    */
+   std::string getReport();
 protected:
    /**
     * @brief List of runs obtained.
-    * Vector containing different runs of the tested program.
+    * Store containing plans of different runs of the tested program. Full runs are deleted after
+    * they are merged into the graph, only the part needed by scheduler is kept (on disk).
+    */
+   RunStore *runs;
+   /**
+    * @brief Pool of workers executing runs.
+    * Workers trace tested program either locally, or in worker processes connected to
+    * the coordinator.
+    */
+   WorkerPool *workerPool;
+   /**
+    * @brief Cache of runs (NULL if runs are not cached).
+    */
+   RunCache *runCache;
+   /**
+    * @brief Saved state of the analysis (NULL if checkpoints are not used).
     */
-   std::vector<Run *> runs;
+   Checkpoint *checkpoint;
    /**
-    * When set to true, analysis will end after finishing current run.
+    * Time when the state of the analysis has been saved last time.
     */
-   bool completed;
+   std::chrono::steady_clock::time_point lastCheckpoint;
    /**
-    * @brief Communication socket.
-    * Socket object responsible for communication with analyzed program. It is used by Tracer
-    * objects for getting messages from analyzed program and sending reactions to them.
+    * True if ::workerPool has been created by the controller (it is not shared).
     */
-   Socket *socket;
+   bool ownPool;
+   /**
+    * Units submitted to ::workerPool in the order they were scheduled.
+    */
+   std::deque<WorkUnit *> executing;
+   /**
+    * Executed units passed to aggregator in the order they were scheduled.
+    */
+   std::deque<WorkUnit *> merging;
    /**
     * @brief Scheduler creatig responses to CONTROL messages.
     * Scheduler object responsible for generating different responses to CONTROL messages in order
@@ -136,12 +168,37 @@ protected:
     * Can be instance of class Aggregator or of one of its inherited classes.
     */
    Aggregator *aggregator;
+   /**
+    * @brief Thread running the aggregator.
+    * Calls are passed to the aggregator through this object, so that the aggregation is performed
+    * outside of the communication with tested program.
+    */
+   AggregatorThread *aggregatorThread;
    /**
     * @brief Configuration of the analyzer.
     * Configuration object containing all configuration of the analyzer obtained from config file.
-    * Controller uses this configuration to set up Tracer, Scheduler and Aggregator objects.
+    * Controller uses this configuration to set up workers, Scheduler and Aggregator objects.
     */
    Configuration *configuration;
+private:
+   /**
+    * @brief Processes unit merged into the graph.
+    * If the run of the unit inserted a new node into the graph, its plan is saved. The run, unit
+    * and its fragment are deleted.
+    * @param unit Unit whose fragment has been merged.
+    */
+   void finishUnit(WorkUnit *unit);
+   /**
+    * @brief Deletes unit together with its fragment and run (if it has been executed).
+    * @param unit Unit to be deleted.
+    */
+   void discardUnit(WorkUnit *unit);
+   /**
+    * @brief Restores state of the analysis from the checkpoint.
+    * Saved runs and graph are loaded and the scheduler continues from the saved position.
+    * @return @a false if there is no checkpoint, otherwise @a true.
+    */
+   bool restoreCheckpoint();
 };
 
 #endif /* CONTROLLER_H_ */
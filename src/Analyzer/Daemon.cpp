@@ -0,0 +1,221 @@
+/**
+ * @file Daemon.cpp
+ *
+ * Contains implementation of methods of the class Daemon.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Daemon.h"
+#include "Controller.h"
+#include "Worker/LocalWorker.h"
+#include "Sandbox.h"
+#include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
+#include "Exceptions/SocketException.h"
+#include "Exceptions/SocketClosedException.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+std::atomic<bool> Daemon::stopping(false);
+
+/**
+ * @brief Constructor creating pool of workers and cache directory.
+ * @param a Path of Unix socket or tcp:HOST:PORT of TCP socket.
+ * @param workers Number of workers shared by all jobs.
+ * @throws SocketException In case a socket can not be created.
+ */
+Daemon::Daemon(std::string a, unsigned workers) :
+      address(a) {
+   // Runs may be large, so the cache is not created in tmpfs
+   char cacheTemplate[] = "/var/tmp/analyzerCache.XXXXXX";
+   if (mkdtemp(cacheTemplate) != NULL)
+      cache = cacheTemplate;
+
+   std::vector<Worker *> localWorkers;
+   for (unsigned i = 0; i < workers; ++i) {
+      localWorkers.push_back(
+            new LocalWorker(
+                  "/tmp/analyserSocket." + std::to_string(getpid()) + "." + std::to_string(i)));
+   }
+   workerPool = new WorkerPool(localWorkers);
+}
+
+/**
+ * @brief Default destructor.
+ * Waits for running jobs, stops workers and removes cache directory.
+ */
+Daemon::~Daemon() {
+   joinJobs(true);
+   delete workerPool;
+   if (!cache.empty())
+      Sandbox::remove(cache);
+}
+
+/**
+ * @brief Accepts and runs jobs until the daemon receives SIGINT or SIGTERM.
+ * @throws SocketException In case listening on the address fails.
+ */
+void Daemon::start() {
+   int listenSocket = Connection::openSocket(address, true);
+
+   // Daemon is stopped by signal
+   struct sigaction action;
+   action.sa_handler = Daemon::stop;
+   sigemptyset(&action.sa_mask);
+   action.sa_flags = 0;
+   sigaction(SIGINT, &action, NULL);
+   sigaction(SIGTERM, &action, NULL);
+
+   std::cerr << "Daemon listening on " << address << " with " << workerPool->getSize()
+         << " workers" << std::endl;
+   while (!stopping) {
+      // Wait for connection with timeout, so that stop flag is checked regularly
+      struct pollfd pfd;
+      pfd.fd = listenSocket;
+      pfd.events = POLLIN;
+      int res = poll(&pfd, 1, 200);
+      joinJobs(false);
+      if (res <= 0)
+         continue;
+      int fd = accept4(listenSocket, NULL, NULL, SOCK_CLOEXEC);
+      if (fd < 0)
+         continue;
+      if (!Connection::isTrusted(fd)) {
+         std::cerr << "Connection of other user refused" << std::endl;
+         close(fd);
+         continue;
+      }
+      // Each job runs in its own thread
+      jobs.emplace_back();
+      Job &job = jobs.back();
+      job.finished = false;
+      job.thread = std::thread(&Daemon::runJob, this, new Connection(fd), &job);
+   }
+
+   close(listenSocket);
+   if (!Connection::isTcp(address))
+      unlink(address.c_str());
+   std::cerr << "Daemon stopping, waiting for " << jobs.size() << " jobs" << std::endl;
+   joinJobs(true);
+}
+
+/**
+ * @brief Submits job to the daemon and waits for its end.
+ * @param address Address where the daemon listens.
+ * @param config Text of the configuration of the job.
+ * @return Report about the analysis.
+ * @throws ConfigurationException, ProtocolException, SocketException In case the analysis failed
+ * in the daemon (same exception as the one thrown in the daemon).
+ * @throws std::runtime_error In case the analysis failed in the daemon by other error.
+ * @throws SocketException In case the daemon is not available.
+ */
+std::string Daemon::submit(std::string address, std::string config) {
+   Connection connection(address);
+   std::string reply;
+   try {
+      connection.sendMsg(config);
+      reply = connection.recvMsg();
+   } catch (SocketClosedException &e) {
+      throw SocketException("Daemon closed connection");
+   }
+
+   // Reply is either "OK", "ERROR <exception type>" or "ERROR" (other errors) followed by
+   // newline and data
+   size_t lineEnd = reply.find('\n');
+   std::string type = reply.substr(0, lineEnd);
+   std::string data = lineEnd != std::string::npos ? reply.substr(lineEnd + 1) : "";
+   if (type == "OK")
+      return data;
+   else if (type == "ERROR CONFIGURATION")
+      throw ConfigurationException(data);
+   else if (type == "ERROR PROTOCOL")
+      throw ProtocolException(data);
+   else if (type == "ERROR SOCKET")
+      throw SocketException(data);
+   else if (type == "ERROR")
+      throw std::runtime_error(data);
+   else
+      throw ProtocolException("Invalid reply from daemon");
+}
+
+/**
+ * @brief Runs one job.
+ * Receives configuration from the client, runs the analysis and sends report back.
+ * Any error of the job is reported to its client only, the daemon keeps running.
+ * @param connection Connection with the client (deleted by this method).
+ * @param job Job structure of the thread.
+ */
+void Daemon::runJob(Connection *connection, Job *job) {
+   try {
+      std::string reply;
+      try {
+         Configuration config;
+         config.parseText(connection->recvMsg());
+         config.setDefaultCache(cache);
+         std::cerr << "Job started: " << config.getDestination() << std::endl;
+         Controller controller(&config, workerPool);
+         controller.startAnalysis();
+         reply = "OK\n" + controller.getReport();
+         std::cerr << "Job finished: " << config.getDestination() << std::endl;
+      } catch (ConfigurationException &e) {
+         reply = "ERROR CONFIGURATION\n" + e.getDescription();
+      } catch (ProtocolException &e) {
+         reply = "ERROR PROTOCOL\n" + e.getDescription();
+      } catch (SocketException &e) {
+         reply = "ERROR SOCKET\n" + e.getDescription();
+      } catch (std::exception &e) {
+         // Failure of one job (e.g. memory exhaustion) does not stop the daemon
+         reply = std::string("ERROR\n") + e.what();
+      } catch (...) {
+         reply = "ERROR\nUnknown error";
+      }
+      connection->sendMsg(reply);
+   } catch (SocketClosedException &e) {
+      // Client disconnected, there is nobody to report to
+   } catch (SocketException &e) {
+      std::cerr << "Job failed: " << e.getDescription() << std::endl;
+   }
+   delete connection;
+   std::lock_guard<std::mutex> lock(jobsMutex);
+   job->finished = true;
+}
+
+/**
+ * @brief Joins threads of finished jobs.
+ * @param all If @a true, waits for all jobs.
+ */
+void Daemon::joinJobs(bool all) {
+   for (auto it = jobs.begin(); it != jobs.end();) {
+      bool finished;
+      {
+         std::lock_guard<std::mutex> lock(jobsMutex);
+         finished = it->finished;
+      }
+      if (finished || all) {
+         it->thread.join();
+         it = jobs.erase(it);
+      }
+      else
+         ++it;
+   }
+}
+
+/**
+ * @brief Handler of SIGINT and SIGTERM.
+ * @param sig Signal number.
+ */
+void Daemon::stop(int sig) {
+   stopping = true;
+}
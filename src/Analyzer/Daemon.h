@@ -0,0 +1,118 @@
+/**
+ * @file Daemon.h
+ *
+ * @brief Daemon class.
+ *
+ * Contains definition of the class Daemon, which runs analyses submitted through a local socket.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef DAEMON_H_
+#define DAEMON_H_
+
+#include "Connection.h"
+#include "Worker/WorkerPool.h"
+
+#include <string>
+#include <list>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+/**
+ * @brief Long-lived analyzer accepting analysis jobs.
+ *
+ * Used when the analyzer is started as "analyzer --daemon ADDRESS [WORKERS]". Listens on
+ * the address for jobs submitted by "analyzer --submit ADDRESS FILENAME [PROGRAM...]". Each job
+ * contains text of the configuration (with the tested program), it is analyzed in its own thread
+ * and the report is sent back to the client.
+ * All jobs share one pool of workers, which is created only once, so several jobs run
+ * concurrently without starting the analyzer again.
+ * State kept between jobs:
+ * - table of variations of functions (Scheduler::variationsMap) is created once per process,
+ * - tested program launched in advance by a worker (option "prelaunch") is used by the next
+ *   job with the same Tracer::launchKey, otherwise it is killed,
+ * - results of runs are stored in a cache directory created by the daemon, which is used by jobs
+ *   without option "cache" (see RunCache), so a job submitted again loads its runs instead of
+ *   executing tested program.
+ *
+ * Each job has its own Controller, so its graph, runs and table of labels (SymbolTable) are
+ * created again. Labels are not shared, because they depend on the aggregator type of the job and
+ * a shared table would need locking on every call of concurrent jobs.
+ * Paths in the configuration are made absolute by ::submit, tested program runs in the working
+ * directory of the daemon.
+ */
+class Daemon {
+public:
+   /**
+    * @brief Constructor creating pool of workers and cache directory.
+    * @param a Path of Unix socket or tcp:HOST:PORT of TCP socket.
+    * @param workers Number of workers shared by all jobs.
+    * @throws SocketException In case a socket can not be created.
+    */
+   Daemon(std::string a, unsigned workers);
+   /**
+    * @brief Default destructor.
+    * Waits for running jobs, stops workers and removes cache directory.
+    */
+   virtual ~Daemon();
+
+   /**
+    * @brief Accepts and runs jobs until the daemon receives SIGINT or SIGTERM.
+    * @throws SocketException In case listening on the address fails.
+    */
+   void start();
+
+   /**
+    * @brief Submits job to the daemon and waits for its end.
+    * @param address Address where the daemon listens.
+    * @param config Text of the configuration of the job.
+    * @return Report about the analysis.
+    * @throws ConfigurationException, ProtocolException, SocketException In case the analysis
+    * failed in the daemon (same exception as the one thrown in the daemon).
+    * @throws std::runtime_error In case the analysis failed in the daemon by other error.
+    * @throws SocketException In case the daemon is not available.
+    */
+   static std::string submit(std::string address, std::string config);
+protected:
+   /**
+    * @brief Job being run.
+    */
+   struct Job {
+      std::thread thread; /**< Thread running the job */
+      bool finished; /**< Set when the thread can be joined (guarded by ::jobsMutex) */
+   };
+
+   std::string address; /**< Address where the daemon listens */
+   WorkerPool *workerPool; /**< Pool of workers shared by all jobs */
+   std::string cache; /**< Cache directory of jobs (empty if it can not be created) */
+   std::list<Job> jobs; /**< Jobs started by the daemon */
+   std::mutex jobsMutex; /**< Mutex guarding ::Job::finished */
+   static std::atomic<bool> stopping; /**< Flag set by signal handler */
+private:
+   /**
+    * @brief Runs one job.
+    * Receives configuration from the client, runs the analysis and sends report back.
+    * Any error of the job is reported to its client only, the daemon keeps running.
+    * @param connection Connection with the client (deleted by this method).
+    * @param job Job structure of the thread.
+    */
+   void runJob(Connection *connection, Job *job);
+   /**
+    * @brief Joins threads of finished jobs.
+    * @param all If @a true, waits for all jobs.
+    */
+   void joinJobs(bool all);
+   /**
+    * @brief Handler of SIGINT and SIGTERM.
+    * @param sig Signal number.
+    */
+   static void stop(int sig);
+};
+
+#endif /* DAEMON_H_ */
@@ -1,38 +1,142 @@
 /**
  * @file Param.cpp
  *
- * File containing implementation of the methods of class Param.
+ * Contains implementation of methods of the class Param.
  *
  * @author Viktor Malik <xmalik11@stud.fit.vutbr.cz>
  *
- * @date 07.03.2014
+ * @date 18.10.2026
  *
- * Created on: Feb 14, 2014
+ * Created on: Oct 18, 2026
  */
 
 #include "Param.h"
+#include "Trace.h"
+
+#include <cstdio>
+#include <cstring>
+
+/**
+ * @brief Constructor creating view of the value in the trace.
+ * @param t Trace containing the value.
+ * @param ty Type of the value.
+ * @param v Number (or index of the string in the trace).
+ */
+Param::Param(Trace *t, paramTypes ty, int64_t v) :
+      trace(t), type(ty), number(v) {
+}
+
+/**
+ * @brief Gets type of the value.
+ * @return Type of the value.
+ */
+paramTypes Param::getType() {
+   return type;
+}
+
+/**
+ * @brief Gets numeric value.
+ * @return The number, for strings the index of the string in the trace.
+ */
+int64_t Param::getNumber() {
+   return number;
+}
+
+/**
+ * @brief Compares the value to another value (possibly from another trace).
+ * Numbers are compared as integers, strings are compared by their text.
+ * @param other Value to be compared.
+ * @return @a true if values have same type and are equal.
+ */
+bool Param::equals(Param other) {
+   if (type != other.type)
+      return false;
+   if (type != PT_STRING)
+      return number == other.number;
+   if (trace == other.trace)
+      return number == other.number;
+   Trace::TStrRef a = trace->interned[number];
+   Trace::TStrRef b = other.trace->interned[other.number];
+   return a.second == b.second
+         && trace->strings.compare(a.first, a.second, other.trace->strings, b.first, b.second) == 0;
+}
+
+/**
+ * @brief Converts the value to text in the form printed by tested program.
+ * @return Text of the value.
+ */
+std::string Param::toString() {
+   if (type == PT_STRING)
+      return trace->getString(trace->interned[number]);
+   return formatNumber(type, number);
+}
+
+/**
+ * @brief Converts the value to typed encoding.
+ * @return Value in typed encoding (as sent by the library).
+ */
+std::string Param::encode() {
+   static const char tags[] = { 's', 'd', 'u', 'p', 'o' };
+   return tags[type] + toString();
+}
 
 /**
- * @brief Default constructor.
- * Creates empty parameter.
+ * @brief Appends binary key of the value.
+ * The key is the type of the value followed by the number (8 bytes) or by the text of the
+ * string, so values are compared by their keys without being formatted.
+ * @param result String the key is appended to.
  */
-Param::Param() :
-      typeName(""), value("") {
+void Param::appendKey(std::string &result) {
+   result += static_cast<char>(type);
+   if (type == PT_STRING) {
+      Trace::TStrRef ref = trace->interned[number];
+      result.append(trace->strings, ref.first, ref.second);
+   }
+   else
+      result.append(reinterpret_cast<const char *>(&number), sizeof(number));
 }
 
 /**
- * @brief Constructor with value initialization.
- * Type name is set to unknown.
- * @param val Value of parameter to be set.
+ * @brief Converts binary key of a value to text.
+ * @param key Key created by ::appendKey.
+ * @param size Length of the key.
+ * @return Text of the value (same as ::toString).
  */
-Param::Param(std::string val) :
-      typeName("unknown"), value(val) {
+std::string Param::keyToString(const char *key, size_t size) {
+   paramTypes keyType = static_cast<paramTypes>(key[0]);
+   if (keyType == PT_STRING)
+      return std::string(key + 1, size - 1);
+   int64_t keyNumber;
+   memcpy(&keyNumber, key + 1, sizeof(keyNumber));
+   return formatNumber(keyType, keyNumber);
 }
 
 /**
- * @brief Gets value of parameter.
- * @return String with parameter value.
+ * @brief Converts number to text in the form printed by tested program.
+ * @param type Type of the number (not PT_STRING).
+ * @param number The number.
+ * @return Text of the number.
  */
-std::string Param::getValue(){
-   return value;
+std::string Param::formatNumber(paramTypes type, int64_t number) {
+   char buf[32] = "";
+   switch (type) {
+   case PT_STRING:
+      break;
+   case PT_INT:
+      snprintf(buf, sizeof(buf), "%lld", (long long) number);
+      break;
+   case PT_UINT:
+      snprintf(buf, sizeof(buf), "%llu", (unsigned long long) number);
+      break;
+   case PT_POINTER:
+      // Same as %p of glibc
+      if (number == 0)
+         return "(nil)";
+      snprintf(buf, sizeof(buf), "0x%llx", (unsigned long long) number);
+      break;
+   case PT_MODE:
+      snprintf(buf, sizeof(buf), "%llo", (unsigned long long) number);
+      break;
+   }
+   return buf;
 }
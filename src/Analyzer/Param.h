@@ -3,61 +3,112 @@
  *
  * @brief Param class.
  *
- * Contains definiton of class Param, which represents a parameter of a call in tested program.
+ * Contains definiton of class Param, which represents a parameter or a return value of a call in
+ * tested program.
  *
  * @author Viktor Malik <xmalik11@stud.fit.vutbr.cz>
  *
- * @date 07.03.2014
+ * @date 18.10.2026
  *
- * Created on: Feb 14, 2014
+ * Created on: Oct 18, 2026
  */
 
 #ifndef PARAM_H_
 #define PARAM_H_
 
 #include <string>
-#include <iostream>
+#include <cstdint>
+
+// Forward declaration of class Trace (for linker)
+class Trace;
+
+/**
+ * Enumeration type representing types of parameters and return values.
+ */
+enum paramTypes {
+   PT_STRING, PT_INT, PT_UINT, PT_POINTER, PT_MODE
+};
 
 /**
- * @brief One parameter of a call in tested program.
+ * @brief Parameter or return value of a call in tested program.
  *
- * Class representing parameter of a call.
- * Provides information about type and value of the parameter.
+ * Values are received from preloaded library in typed encoding: the first character is type of
+ * the value followed by the value printed as by printf:
+ * - d - signed integer (file descriptors, flags, offsets),
+ * - u - unsigned integer (sizes),
+ * - p - pointer,
+ * - o - mode or permissions (printed in octal),
+ * - s - path or other string.
  *
- * @todo Providing type is not implemented.
+ * Numbers are stored in the trace as 64-bit integers, so they are compared without being
+ * converted to strings. Strings are interned in the trace, each distinct string of the trace is
+ * stored only once and the value of the parameter is index of the string. Like Call, the
+ * parameter is only a view into the trace, so it is passed by value.
  */
 class Param {
 public:
    /**
-    * @brief Default constructor.
-    * Creates empty parameter.
+    * @brief Constructor creating view of the value in the trace.
+    * @param t Trace containing the value.
+    * @param ty Type of the value.
+    * @param v Number (or index of the string in the trace).
+    */
+   Param(Trace *t, paramTypes ty, int64_t v);
+
+   /**
+    * @brief Gets type of the value.
+    * @return Type of the value.
     */
-   Param();
+   paramTypes getType();
    /**
-    * @brief Constructor with value initialization.
-    * Type name is set to unknown.
-    * @param val Value of parameter to be set.
+    * @brief Gets numeric value.
+    * @return The number, for strings the index of the string in the trace.
     */
-   Param(std::string val);
+   int64_t getNumber();
    /**
-    * @brief Default destructor.
+    * @brief Compares the value to another value (possibly from another trace).
+    * Numbers are compared as integers, strings are compared by their text.
+    * @param other Value to be compared.
+    * @return @a true if values have same type and are equal.
     */
-   virtual ~Param(){}
+   bool equals(Param other);
    /**
-    * @brief Gets value of parameter.
-    * @return String with parameter value.
+    * @brief Converts the value to text in the form printed by tested program.
+    * @return Text of the value.
     */
-   std::string getValue();
+   std::string toString();
    /**
-    * @brief Method to print the parameter.
+    * @brief Converts the value to typed encoding.
+    * @return Value in typed encoding (as sent by the library).
     */
-   void print(){
-      std::cout << value << ", ";
-   }
+   std::string encode();
+   /**
+    * @brief Appends binary key of the value.
+    * The key is the type of the value followed by the number (8 bytes) or by the text of the
+    * string, so values are compared by their keys without being formatted.
+    * @param result String the key is appended to.
+    */
+   void appendKey(std::string &result);
+   /**
+    * @brief Converts binary key of a value to text.
+    * @param key Key created by ::appendKey.
+    * @param size Length of the key.
+    * @return Text of the value (same as ::toString).
+    */
+   static std::string keyToString(const char *key, size_t size);
 
 protected:
-   std::string typeName; /**< String with name of the type of parameter */
-   std::string value; /**< String with value of the parameter */
+   /**
+    * @brief Converts number to text in the form printed by tested program.
+    * @param type Type of the number (not PT_STRING).
+    * @param number The number.
+    * @return Text of the number.
+    */
+   static std::string formatNumber(paramTypes type, int64_t number);
+
+   Trace *trace; /**< Trace containing the value */
+   paramTypes type; /**< Type of the value */
+   int64_t number; /**< Number or index of the string in the trace */
 };
 
 #endif /* PARAM_H_ */
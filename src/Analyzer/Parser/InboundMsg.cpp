@@ -11,20 +11,26 @@
  */
 
 #include "Parser/InboundMsg.h"
-#include "Param.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <cstring>
 
 /**
- * @brief Default constructor.
+ * @brief Constructor with trace initialization.
  * Creates empty message.
+ * @param t Trace where calls from the messages are added (may be NULL if no call is expected).
  */
-InboundMsg::InboundMsg() :
-      Message(), call(NULL) {
+InboundMsg::InboundMsg(Trace *t) :
+      Message(), trace(t) {
 }
 
 /**
  * @brief Parses incoming message.
+ * CONTROL and NOTIFY messages add new call to the trace, RETURN message sets return value of
+ * the last call in the trace.
  * @see Message::parse.
  * @param msg Stirng to be parsed.
+ * @throws ProtocolException In case a call is received, but there is no trace.
  */
 void InboundMsg::parse(std::string msg) {
    size_t oldPos, newPos, endPos;
@@ -35,24 +41,27 @@ void InboundMsg::parse(std::string msg) {
    // Find first CRLF
    newPos = msg.find("\r\n");
    // First line is message type
-   type = Message::typesStr[msg.substr(0, newPos)];
+   auto typeIt = Message::typesStr.find(msg.substr(0, newPos));
+   type = typeIt != Message::typesStr.end() ? typeIt->second : UNDEF;
+
+   if ((type == CONTROL || type == NOTIFY || type == RETURN) && trace == NULL)
+      throw ProtocolException("Unexpected call message");
 
    if (type == CONTROL || type == NOTIFY) {
-      call = new Call();
       // Find second CRLF
       oldPos = newPos + 2;
       newPos = msg.find("\r\n", oldPos);
       // Second line is call name
-      call->setFunctionName(msg.substr(oldPos, newPos - oldPos));
+      trace->addCall(msg.data() + oldPos, newPos - oldPos);
 
       // Find all lines with parameters and parse them
-      Param *param;
       while (newPos != endPos) {
          oldPos = newPos + 2;
          newPos = msg.find("\r\n", oldPos);
-         std::string paramVal = msg.substr(oldPos, newPos - oldPos).c_str();
-         param = new Param(paramVal);
-         call->addParam(param);
+         // Parameter value ends at the first zero character (as C string)
+         const char *value = msg.data() + oldPos;
+         const char *zero = static_cast<const char *>(memchr(value, '\0', newPos - oldPos));
+         trace->addParam(value, zero != NULL ? zero - value : newPos - oldPos);
       }
    }
    else if (type == RETURN) {
@@ -60,7 +69,8 @@ void InboundMsg::parse(std::string msg) {
       oldPos = newPos + 2;
       newPos = msg.find("\r\n", oldPos);
       // Second line is return value
-      call->setReturnVal(msg.substr(oldPos, newPos - oldPos));
+      if (trace->getSize() > 0)
+         trace->setReturnVal(msg.data() + oldPos, newPos - oldPos);
    }
 }
 
@@ -76,9 +86,9 @@ std::string InboundMsg::compose() {
 
 /**
  * @brief Gets the call contained in the message.
- * @return Pointer to the call.
+ * @return View of the call in the trace.
  */
-Call *InboundMsg::getCall() {
-   return call;
+Call InboundMsg::getCall() {
+   return trace->getCall(trace->getSize() - 1);
 }
 
@@ -17,20 +17,24 @@
 
 #include "Parser/Message.h"
 #include "Call.h"
+#include "Trace.h"
 
 /**
  * @brief Incoming message from tested program.
  * Class representing incoming messages during main communication and initial phase.
- * This message informs about a call that is to be performed in the tested program.
+ * This message informs about a call that is to be performed in the tested program. The call is
+ * added directly to the trace of tested program.
  * Extends Message and implements it virtual method ::parse.
  */
 class InboundMsg: public Message {
 public:
    /**
-    * @brief Default constructor.
+    * @brief Constructor with trace initialization.
     * Creates empty message.
+    * @param t Trace where calls from the messages are added (may be NULL if no call is
+    * expected).
     */
-   InboundMsg();
+   InboundMsg(Trace *t = NULL);
    /**
     * @brief Default destructor.
     */
@@ -38,8 +42,11 @@ public:
    }
    /**
     * @brief Parses incoming message.
+    * CONTROL and NOTIFY messages add new call to the trace, RETURN message sets return value of
+    * the last call in the trace.
     * @see Message::parse.
     * @param msg Stirng to be parsed.
+    * @throws ProtocolException In case a call is received, but there is no trace.
     */
    void parse(std::string msg);
    /**
@@ -51,11 +58,11 @@ public:
    std::string compose();
    /**
     * @brief Gets the call contained in the message.
-    * @return Pointer to the call.
+    * @return View of the call in the trace.
     */
-   Call *getCall();
+   Call getCall();
 protected:
-   Call *call; /**< Call that the message informed about. */
+   Trace *trace; /**< Trace where calls from the messages are added */
 };
 
 #endif /* INBOUNDMSG_H_ */
@@ -14,6 +14,8 @@
 #include "Call.h"
 #include "Exceptions/ConfigurationException.h"
 
+#include <algorithm>
+
 /**
  * @brief Default constructor.
  * Creates empty message with undefined type.
@@ -53,13 +55,13 @@ void InitialMsg::parse(std::string msg) {
 std::string InitialMsg::compose() {
    std::string msg;
    // Write type + CRLF
-   msg = Message::typesEnum[type];
+   msg = Message::typesEnum.at(type);
    msg += "\r\n";
 
    if (type == OPTION) {
       // NOTIFICATION part
       msg += "NOTIFICATION\r\n";
-      msg += listTEnum[notifyType];
+      msg += listTEnum.at(notifyType);
       msg += "\r\n";
 
       // Write functions list (CRLF after each)
@@ -70,7 +72,7 @@ std::string InitialMsg::compose() {
 
       // CONTROL part
       msg += "CONTROL\r\n";
-      msg += listTEnum[controlType];
+      msg += listTEnum.at(controlType);
       msg += "\r\n";
 
       // Write functions list (CRLF after each)
@@ -163,6 +165,20 @@ std::vector<std::string> InitialMsg::getControlFunctions() {
    return controlList;
 }
 
+/**
+ * @brief Checks if function is controlled according to control list.
+ * @param f Name of the function.
+ * @return @a True if the function is controlled, otherwise @a false.
+ */
+bool InitialMsg::isControlled(std::string f) {
+   if (controlType == ALL)
+      return Call::isControlFunction(f);
+   else if (controlType == INCLUDE)
+      return std::find(controlList.begin(), controlList.end(), f) != controlList.end();
+   else
+      return false;
+}
+
 /**
  * Initialization of static dictionary mapping list types from ::listType into their names as
  * strings.
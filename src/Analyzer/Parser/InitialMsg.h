@@ -114,6 +114,12 @@ public:
     * Call::functionsMap)
     */
    std::vector<std::string> getControlFunctions();
+   /**
+    * @brief Checks if function is controlled according to control list.
+    * @param f Name of the function.
+    * @return @a True if the function is controlled, otherwise @a false.
+    */
+   bool isControlled(std::string f);
 
    /**
     * Static dictionary mapping list type into its string representation.
@@ -57,7 +57,7 @@ void OutboundMsg::parse(std::string msg) {
 std::string OutboundMsg::compose() {
    std::string msg;
    // Write message type + CRLF
-   msg = Message::typesEnum[type];
+   msg = Message::typesEnum.at(type);
    msg += "\r\n";
    if (type == EXEC) {
       // Write function name + CRLF
@@ -11,8 +11,36 @@
  */
 
 #include "Run.h"
+#include "Exceptions/ProtocolException.h"
 
 #include <iostream>
+#include <sstream>
+
+/**
+ * @brief Writes string to the stream prefixed by its length.
+ * Strings can contain any characters (e.g. spaces in file paths).
+ * @param os Output stream.
+ * @param str String to be written.
+ */
+static void writeString(std::ostream &os, const std::string &str) {
+   os << " " << str.size() << ":" << str;
+}
+
+/**
+ * @brief Reads string written by ::writeString from the stream.
+ * @param is Input stream.
+ * @return String read.
+ * @throws ProtocolException In case the stream does not contain the string.
+ */
+static std::string readString(std::istream &is) {
+   size_t size;
+   if (!(is >> size) || is.get() != ':')
+      throw ProtocolException("Invalid run");
+   std::string str(size, '\0');
+   if (size > 0 && !is.read(&str[0], size))
+      throw ProtocolException("Invalid run");
+   return str;
+}
 
 /**
  * @brief Default constructor.
@@ -24,12 +52,8 @@ Run::Run() :
 
 /**
  * @brief Default destructor.
- * As each call belongs exactly to one run, this is the place where all calls are destroyed.
  */
 Run::~Run() {
-   for (auto call : calls) {
-      delete call;
-   }
 }
 
 /**
@@ -48,15 +72,65 @@ unsigned Run::getDepth() {
    return depth;
 }
 
+/**
+ * @brief Creates text representation of the run.
+ * The text contains depth of the run and all its calls with parameters, return values and used
+ * variants, so the run can be sent between processes. Parameters and return values are written in
+ * typed encoding (see Param).
+ * @return Text of the run.
+ */
+std::string Run::compose() {
+   std::ostringstream msg;
+   msg << depth << " " << getSize();
+   for (unsigned c = 0; c < getSize(); ++c) {
+      Call call = getCall(c);
+      writeString(msg, call.getName());
+      msg << " " << call.getVariant() << " " << call.paramsCnt();
+      for (int i = 0; i < call.paramsCnt(); ++i) {
+         writeString(msg, call.getParam(i).encode());
+      }
+      writeString(msg, call.getReturnVal().encode());
+   }
+   return msg.str();
+}
+
+/**
+ * @brief Parses text representation of the run.
+ * Calls of the run are created from the text.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid run.
+ */
+void Run::parse(std::string msg) {
+   std::istringstream isMsg(msg);
+   unsigned size;
+   if (!(isMsg >> depth >> size))
+      throw ProtocolException("Invalid run");
+   for (unsigned i = 0; i < size; ++i) {
+      std::string str = readString(isMsg);
+      Call call = addCall(str.data(), str.size());
+      int variant, paramsCnt;
+      if (!(isMsg >> variant >> paramsCnt))
+         throw ProtocolException("Invalid run");
+      call.setVariant(variant);
+      for (int p = 0; p < paramsCnt; ++p) {
+         str = readString(isMsg);
+         addParam(str.data(), str.size());
+      }
+      str = readString(isMsg);
+      setReturnVal(str.data(), str.size());
+   }
+}
+
 /**
  * @brief Prints the run.
  */
 void Run::print() {
    std::cout << std::endl;
-   for (auto call : calls) {
-      std::cout << call->getName() << "(";
-      call->printParams();
-      std::cout << ") = " << call->getReturnVal() << std::endl;
+   for (unsigned c = 0; c < getSize(); ++c) {
+      Call call = getCall(c);
+      std::cout << call.getName() << "(";
+      call.printParams();
+      std::cout << ") = " << call.getReturnVal().toString() << std::endl;
    }
    std::cout << "Depth: " << depth << std::endl;
    std::cout << std::endl;
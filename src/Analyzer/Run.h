@@ -19,6 +19,7 @@
 #include "Trace.h"
 
 #include <vector>
+#include <string>
 
 /**
  * @brief A run of one instance of the tested program.
@@ -37,7 +38,6 @@ public:
    Run();
    /**
     * @brief Default destructor.
-    * As each call belongs exactly to one call, this is the place where all calls are destroyed.
     */
    virtual ~Run();
 
@@ -52,6 +52,22 @@ public:
     */
    unsigned getDepth();
 
+   /**
+    * @brief Creates text representation of the run.
+    * The text contains depth of the run and all its calls with parameters, return values and
+    * used variants, so the run can be sent between processes. Parameters and return values are
+    * written in typed encoding (see Param).
+    * @return Text of the run.
+    */
+   std::string compose();
+   /**
+    * @brief Parses text representation of the run.
+    * Calls of the run are created from the text.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid run.
+    */
+   void parse(std::string msg);
+
    /**
     * @brief Prints the run.
     */
@@ -0,0 +1,432 @@
+/**
+ * @file RunCache.cpp
+ *
+ * Contains implementation of methods of the class RunCache.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "RunCache.h"
+#include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <climits>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+/**
+ * Version of the cache files, must be changed when format of the key or of the run changes.
+ */
+static const unsigned CACHE_VERSION = 3;
+
+/**
+ * @brief Constructor creating the part of the key common for all runs of the analysis.
+ * @param d Cache directory (created if it does not exist).
+ * @param config Configuration of the analysis.
+ * @throws ConfigurationException In case the directory can not be created or tested program can
+ * not be read.
+ */
+RunCache::RunCache(std::string d, Configuration *config) :
+      dir(d), incremental(config->checkIncremental()), initial(NULL), divergence(-1), hits(0),
+      reused(0) {
+   if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST)
+      throw ConfigurationException("Creating cache directory failed");
+
+   // Part of the key which identifies the analysis
+   std::ostringstream analysis;
+   analysis << "version " << CACHE_VERSION << "\n";
+   for (auto &arg : config->getProgram())
+      analysis << "arg " << arg.size() << " " << arg << "\n";
+   for (auto &variant : config->getVariants())
+      analysis << "variants " << variant << "\n";
+   for (auto &path : config->getSandbox())
+      analysis << "sandbox " << path << "\n";
+   // Any change of the analyzer, tested program, library or sandbox files invalidates the runs
+   std::ostringstream digests;
+   digests << "analyzer " << digest("/proc/self/exe") << "\n";
+   digests << "program " << digest(config->getProgramPath()) << "\n";
+   digests << "library " << digest("bin/lib_filesystem.so") << "\n";
+   for (auto &path : config->getSandbox())
+      digests << "sandbox " << digest(path) << "\n";
+   std::string common = analysis.str() + digests.str();
+
+   std::string firstOption = "option " + config->getFirstInitMsg()->compose() + "\n";
+   std::string option = "option " + config->getInitMsg()->compose() + "\n";
+   firstKey = common + firstOption;
+   key = common + option;
+
+   // Digests used by the last analysis are stored in a file identified by the analysis, the
+   // file is replaced when this analysis succeeds (see ::finish)
+   lastPath = filePath(analysis.str()) + ".last";
+   lastDigests = digests.str();
+   std::ifstream lastFile(lastPath, std::ifstream::in | std::ifstream::binary);
+   if (lastFile.is_open()) {
+      std::stringstream previousDigests;
+      previousDigests << lastFile.rdbuf();
+      if (previousDigests.str() != digests.str()) {
+         previousFirstKey = analysis.str() + previousDigests.str() + firstOption;
+         previousKey = analysis.str() + previousDigests.str() + option;
+      }
+      lastFile.close();
+   }
+}
+
+/**
+ * @brief Default destructor.
+ */
+RunCache::~RunCache() {
+   delete initial;
+}
+
+/**
+ * @brief Loads run of the unit from the cache.
+ * In incremental analysis, run of the previous analysis is loaded if the unit is not affected by
+ * the change of tested program.
+ * @param unit Executed unit.
+ * @return Stored run or NULL if the cache does not contain the run.
+ */
+Run *RunCache::load(WorkUnit *unit) {
+   Run *run = loadKey(unitKey(unit, false));
+   if (run != NULL) {
+      hits++;
+      if (unit->isInitial())
+         findDivergence(run);
+      return run;
+   }
+   if (!incremental)
+      return NULL;
+
+   // Run reused by an interrupted incremental analysis of the same program
+   run = loadKey(reusedKey(unitKey(unit, false)));
+   if (run != NULL) {
+      reused++;
+      return run;
+   }
+
+   // Run of the previous analysis is used if it has not been affected by the change
+   int affected = unit->getFirstAffectedCall();
+   if (previousKey.empty() || affected < 0 || affected >= divergence)
+      return NULL;
+   run = loadKey(unitKey(unit, true));
+   if (run == NULL)
+      run = loadKey(reusedKey(unitKey(unit, true)));
+   if (run != NULL && !samePrefix(run, affected)) {
+      // Previous program behaved differently before the affected call
+      delete run;
+      return NULL;
+   }
+   if (run != NULL) {
+      reused++;
+      // Reused run is not a result of this program, so it is stored apart from executed runs
+      // and it is never loaded by an analysis which is not incremental
+      writeRun(reusedKey(unitKey(unit, false)), run);
+   }
+   return run;
+}
+
+/**
+ * @brief Stores run of the unit into the cache.
+ * Errors are ignored, the run is just not cached.
+ * @param unit Executed unit.
+ * @param run Run of tested program created by the unit.
+ */
+void RunCache::store(WorkUnit *unit, Run *run) {
+   writeRun(unitKey(unit, false), run);
+   if (unit->isInitial())
+      findDivergence(run);
+}
+
+/**
+ * @brief Records digests of this analysis as the last ones.
+ * Called when the analysis succeeds, so that an interrupted analysis does not replace digests of
+ * the previous analysis and its runs are still reused when the analysis is started again.
+ */
+void RunCache::finish() {
+   writeFile(lastPath, lastDigests);
+}
+
+/**
+ * @brief Gets number of runs loaded from the cache.
+ * @return Number of cache hits.
+ */
+unsigned RunCache::getHits() {
+   return hits;
+}
+
+/**
+ * @brief Gets number of runs reused from the previous analysis.
+ * @return Number of runs reused in incremental analysis.
+ */
+unsigned RunCache::getReused() {
+   return reused;
+}
+
+/**
+ * @brief Creates key of the unit.
+ * @param unit Executed unit.
+ * @param previous If @a true, key of the run in the previous analysis is created.
+ * @return Text of the key.
+ */
+std::string RunCache::unitKey(WorkUnit *unit, bool previous) {
+   std::string common;
+   if (previous)
+      common = unit->isInitial() ? previousFirstKey : previousKey;
+   else
+      common = unit->isInitial() ? firstKey : key;
+   return common + "unit " + unit->compose() + "\n";
+}
+
+/**
+ * @brief Creates key of the run reused from the previous analysis.
+ * @param k Key of the unit.
+ * @return Key in the namespace of reused runs.
+ */
+std::string RunCache::reusedKey(const std::string &k) {
+   return "reused\n" + k;
+}
+
+/**
+ * @brief Writes run with given key.
+ * Errors are ignored, the run is just not cached.
+ * @param k Key of the run.
+ * @param run Run to be written.
+ */
+void RunCache::writeRun(const std::string &k, Run *run) {
+   std::ostringstream data;
+   data << k.size() << "\n" << k << run->compose();
+   writeFile(filePath(k), data.str());
+}
+
+/**
+ * @brief Loads run with given key.
+ * @param k Key of the run.
+ * @return Stored run or NULL if the cache does not contain the run.
+ */
+Run *RunCache::loadKey(const std::string &k) {
+   std::ifstream file(filePath(k), std::ifstream::in | std::ifstream::binary);
+   if (!file.is_open())
+      return NULL;
+
+   // File starts with the key, which must be the same as the key of the unit
+   size_t keySize;
+   if (!(file >> keySize) || file.get() != '\n' || keySize != k.size())
+      return NULL;
+   std::string storedKey(keySize, '\0');
+   if (!file.read(&storedKey[0], keySize) || storedKey != k)
+      return NULL;
+
+   std::stringstream runText;
+   runText << file.rdbuf();
+   Run *run = new Run();
+   try {
+      run->parse(runText.str());
+   } catch (ProtocolException &e) {
+      // Damaged file, run will be executed again
+      delete run;
+      return NULL;
+   }
+   return run;
+}
+
+/**
+ * @brief Writes file in the cache.
+ * The file is written under temporary name and renamed, so concurrent analyses never read
+ * an incomplete file. Errors are ignored, the file is just not written.
+ * @param path Path of the file.
+ * @param data Content of the file.
+ */
+void RunCache::writeFile(const std::string &path, const std::string &data) {
+   std::ostringstream tmpPath;
+   tmpPath << path << "." << getpid() << "."
+         << std::hash<std::thread::id>()(std::this_thread::get_id()) << ".tmp";
+
+   std::ofstream file(tmpPath.str(), std::ofstream::out | std::ofstream::binary);
+   if (!file.is_open())
+      return;
+   file << data;
+   file.close();
+   if (!file || rename(tmpPath.str().c_str(), path.c_str()) != 0)
+      unlink(tmpPath.str().c_str());
+}
+
+/**
+ * @brief Finds the first call where the initial run differs from the previous analysis.
+ * Runs which change behavior of tested program before this call are not affected by the change
+ * of tested program and they are reused from the previous analysis.
+ * Values of pointers are not compared, as they differ between runs.
+ * @param run Initial run of the analysis.
+ */
+void RunCache::findDivergence(Run *run) {
+   if (!incremental || previousFirstKey.empty())
+      return;
+   WorkUnit initialUnit;
+   Run *previous = loadKey(unitKey(&initialUnit, true));
+   if (previous == NULL) {
+      // Nothing can be reused
+      divergence = 0;
+      return;
+   }
+   unsigned i = 0;
+   while (i < run->getSize() && i < previous->getSize()
+         && sameCall(run->getCall(i), previous->getCall(i)))
+      i++;
+   delete previous;
+   // Copy of the run is kept for validation of reused runs, it is created before divergence is
+   // set, so it is complete when other threads read it
+   initial = new Run();
+   initial->parse(run->compose());
+   divergence = i;
+}
+
+/**
+ * @brief Checks that reused run behaves like the initial run before the affected call.
+ * Calls of the run before the first call affected by its unit must be same as the calls of
+ * the initial run of this analysis, otherwise the run does not belong to the current program.
+ * @param run Run of the previous analysis.
+ * @param affected First call affected by the unit of the run.
+ * @return @a true if the prefix of the run is same as the prefix of the initial run.
+ */
+bool RunCache::samePrefix(Run *run, int affected) {
+   if (initial == NULL || run->getSize() <= (unsigned) affected
+         || initial->getSize() < (unsigned) affected)
+      return false;
+   for (int i = 0; i < affected; ++i) {
+      if (!sameCall(run->getCall(i), initial->getCall(i)))
+         return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Compares calls of two runs.
+ * @param a First call.
+ * @param b Second call.
+ * @return @a true if the calls have same function, parameters and return value.
+ */
+bool RunCache::sameCall(Call a, Call b) {
+   if (a.getFunction() != b.getFunction() || a.paramsCnt() != b.paramsCnt()
+         || !sameValue(a.getReturnVal(), b.getReturnVal()))
+      return false;
+   for (int i = 0; i < a.paramsCnt(); ++i) {
+      if (!sameValue(a.getParam(i), b.getParam(i)))
+         return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Compares values of parameters or return values.
+ * @param a First value.
+ * @param b Second value.
+ * @return @a true if values are equal or both of them are pointers.
+ */
+bool RunCache::sameValue(Param a, Param b) {
+   if (a.getType() == PT_POINTER && b.getType() == PT_POINTER)
+      return true;
+   return a.equals(b);
+}
+
+/**
+ * @brief Gets path of the file with the run.
+ * @param k Key of the run.
+ * @return Path of the file in cache directory.
+ */
+std::string RunCache::filePath(const std::string &k) {
+   uint64_t hash = 14695981039346656037ULL;
+   hashData(hash, k.c_str(), k.size());
+   std::ostringstream path;
+   path << dir << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".run";
+   return path.str();
+}
+
+/**
+ * @brief Adds data to the hash.
+ * 64-bit FNV-1a hash is used.
+ * @param hash Hash value to be updated.
+ * @param data Data to be hashed.
+ * @param size Size of data.
+ */
+void RunCache::hashData(uint64_t &hash, const char *data, size_t size) {
+   for (size_t i = 0; i < size; ++i) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+   }
+}
+
+/**
+ * @brief Adds file or directory (recursively) to the hash.
+ * Names, types and contents of files are hashed, entries of directories are hashed in
+ * alphabetical order.
+ * @param hash Hash value to be updated.
+ * @param path Path of the file.
+ * @return @a true if the file has been read, otherwise @a false.
+ */
+bool RunCache::hashPath(uint64_t &hash, std::string path) {
+   struct stat st;
+   if (stat(path.c_str(), &st) != 0)
+      return false;
+
+   if (S_ISDIR(st.st_mode)) {
+      hashData(hash, "D", 1);
+      DIR *d = opendir(path.c_str());
+      if (d == NULL)
+         return false;
+      std::vector<std::string> names;
+      struct dirent *entry;
+      while ((entry = readdir(d)) != NULL) {
+         std::string name(entry->d_name);
+         if (name != "." && name != "..")
+            names.push_back(name);
+      }
+      closedir(d);
+      std::sort(names.begin(), names.end());
+      for (auto &name : names) {
+         // Name is hashed with terminating zero, so names can not be mixed with contents
+         hashData(hash, name.c_str(), name.size() + 1);
+         if (!hashPath(hash, path + "/" + name))
+            return false;
+      }
+      return true;
+   }
+
+   hashData(hash, "F", 1);
+   int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+   if (fd < 0)
+      return false;
+   char buf[65536];
+   ssize_t res;
+   while ((res = read(fd, buf, sizeof(buf))) > 0)
+      hashData(hash, buf, res);
+   close(fd);
+   return res == 0;
+}
+
+/**
+ * @brief Creates digest of file or directory.
+ * @param path Path of the file.
+ * @return Hexadecimal digest.
+ * @throws ConfigurationException In case the file can not be read.
+ */
+std::string RunCache::digest(std::string path) {
+   uint64_t hash = 14695981039346656037ULL;
+   if (!hashPath(hash, path))
+      throw ConfigurationException("Reading " + path + " for cache failed");
+   std::ostringstream result;
+   result << std::hex << std::setw(16) << std::setfill('0') << hash;
+   return result.str();
+}
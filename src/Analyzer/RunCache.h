@@ -0,0 +1,212 @@
+/**
+ * @file RunCache.h
+ *
+ * @brief RunCache class.
+ *
+ * Contains definition of the class RunCache, which stores runs of tested program on disk, so
+ * they can be reused by later analyses.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef RUNCACHE_H_
+#define RUNCACHE_H_
+
+#include "Configuration.h"
+#include "Run.h"
+#include "Call.h"
+#include "Scheduler/WorkUnit.h"
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Persistent cache of runs.
+ *
+ * Used when option cache is set. Each run is stored in its own file in the cache directory.
+ * The run is identified by a key, which consists of:
+ * - digests of the analyzer, tested program and preloaded library executables,
+ * - arguments of tested program,
+ * - options which affect runs (OPTION message and variants),
+ * - digest of files copied into sandbox (if it is used),
+ * - the work unit (variants of the calls of the run).
+ * Name of the file is a hash of the key and the whole key is stored in the file, so a run is
+ * never used for another key. When the run with the same key is needed again, it is loaded
+ * from the file instead of executing tested program.
+ * Files used by tested program outside of the sandbox are not part of the key.
+ *
+ * If incremental analysis is enabled and tested program (or other part of the key with digest)
+ * has changed since the last analysis with same arguments and options, runs of the last analysis
+ * are reused where the change is not expected to have effect. The initial run is always executed
+ * and compared to the previous initial run. A run which changes behavior of tested program
+ * before the first call where initial runs differ is reused if its calls before the changed
+ * behavior are same as the calls of the new initial run, other runs are executed again.
+ * Reused runs are stored under a separate key (see ::reusedKey), so they are never loaded as
+ * runs of the changed program by an analysis which is not incremental.
+ * This assumes that the change affects only calls after the first different call; if a reused
+ * run reaches the changed code by another path, the change is not reflected in the graph.
+ */
+class RunCache {
+public:
+   /**
+    * @brief Constructor creating the part of the key common for all runs of the analysis.
+    * @param d Cache directory (created if it does not exist).
+    * @param config Configuration of the analysis.
+    * @throws ConfigurationException In case the directory can not be created or tested program
+    * can not be read.
+    */
+   RunCache(std::string d, Configuration *config);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~RunCache();
+
+   /**
+    * @brief Loads run of the unit from the cache.
+    * In incremental analysis, run of the previous analysis is loaded if the unit is not affected
+    * by the change of tested program.
+    * @param unit Executed unit.
+    * @return Stored run or NULL if the cache does not contain the run.
+    */
+   Run *load(WorkUnit *unit);
+   /**
+    * @brief Stores run of the unit into the cache.
+    * Errors are ignored, the run is just not cached.
+    * @param unit Executed unit.
+    * @param run Run of tested program created by the unit.
+    */
+   void store(WorkUnit *unit, Run *run);
+   /**
+    * @brief Records digests of this analysis as the last ones.
+    * Called when the analysis succeeds, so that an interrupted analysis does not replace digests
+    * of the previous analysis and its runs are still reused when the analysis is started again.
+    */
+   void finish();
+   /**
+    * @brief Gets number of runs loaded from the cache.
+    * @return Number of cache hits.
+    */
+   unsigned getHits();
+   /**
+    * @brief Gets number of runs reused from the previous analysis.
+    * @return Number of runs reused in incremental analysis.
+    */
+   unsigned getReused();
+protected:
+   std::string dir; /**< Cache directory */
+   std::string firstKey; /**< Common part of the key for the initial unit */
+   std::string key; /**< Common part of the key for other units */
+   bool incremental; /**< True if runs of the previous analysis may be reused */
+   std::string previousFirstKey; /**< ::firstKey of the previous analysis (empty if there is none
+                                  * or nothing has changed) */
+   std::string previousKey; /**< ::key of the previous analysis */
+   std::string lastPath; /**< File with digests of the last analysis */
+   std::string lastDigests; /**< Digests of this analysis */
+   Run *initial; /**< Copy of the initial run (NULL if runs are not reused) */
+   std::atomic<int> divergence; /**< First call where initial runs differ (-1 if unknown) */
+   std::atomic<unsigned> hits; /**< Number of runs loaded from the cache */
+   std::atomic<unsigned> reused; /**< Number of runs reused from the previous analysis */
+private:
+   /**
+    * @brief Creates key of the unit.
+    * @param unit Executed unit.
+    * @param previous If @a true, key of the run in the previous analysis is created.
+    * @return Text of the key.
+    */
+   std::string unitKey(WorkUnit *unit, bool previous);
+   /**
+    * @brief Creates key of the run reused from the previous analysis.
+    * @param k Key of the unit.
+    * @return Key in the namespace of reused runs.
+    */
+   static std::string reusedKey(const std::string &k);
+   /**
+    * @brief Writes run with given key.
+    * Errors are ignored, the run is just not cached.
+    * @param k Key of the run.
+    * @param run Run to be written.
+    */
+   void writeRun(const std::string &k, Run *run);
+   /**
+    * @brief Loads run with given key.
+    * @param k Key of the run.
+    * @return Stored run or NULL if the cache does not contain the run.
+    */
+   Run *loadKey(const std::string &k);
+   /**
+    * @brief Writes file in the cache.
+    * The file is written under temporary name and renamed, so concurrent analyses never read
+    * an incomplete file. Errors are ignored, the file is just not written.
+    * @param path Path of the file.
+    * @param data Content of the file.
+    */
+   static void writeFile(const std::string &path, const std::string &data);
+   /**
+    * @brief Finds the first call where the initial run differs from the previous analysis.
+    * Runs which change behavior of tested program before this call are not affected by
+    * the change of tested program and they are reused from the previous analysis.
+    * Values of pointers are not compared, as they differ between runs.
+    * @param run Initial run of the analysis.
+    */
+   void findDivergence(Run *run);
+   /**
+    * @brief Checks that reused run behaves like the initial run before the affected call.
+    * Calls of the run before the first call affected by its unit must be same as the calls of
+    * the initial run of this analysis, otherwise the run does not belong to the current program.
+    * @param run Run of the previous analysis.
+    * @param affected First call affected by the unit of the run.
+    * @return @a true if the prefix of the run is same as the prefix of the initial run.
+    */
+   bool samePrefix(Run *run, int affected);
+   /**
+    * @brief Compares calls of two runs.
+    * @param a First call.
+    * @param b Second call.
+    * @return @a true if the calls have same function, parameters and return value.
+    */
+   static bool sameCall(Call a, Call b);
+   /**
+    * @brief Compares values of parameters or return values.
+    * @param a First value.
+    * @param b Second value.
+    * @return @a true if values are equal or both of them are pointers.
+    */
+   static bool sameValue(Param a, Param b);
+   /**
+    * @brief Gets path of the file with the run.
+    * @param k Key of the run.
+    * @return Path of the file in cache directory.
+    */
+   std::string filePath(const std::string &k);
+   /**
+    * @brief Adds data to the hash.
+    * 64-bit FNV-1a hash is used.
+    * @param hash Hash value to be updated.
+    * @param data Data to be hashed.
+    * @param size Size of data.
+    */
+   static void hashData(uint64_t &hash, const char *data, size_t size);
+   /**
+    * @brief Adds file or directory (recursively) to the hash.
+    * Names, types and contents of files are hashed, entries of directories are hashed in
+    * alphabetical order.
+    * @param hash Hash value to be updated.
+    * @param path Path of the file.
+    * @return @a true if the file has been read, otherwise @a false.
+    */
+   static bool hashPath(uint64_t &hash, std::string path);
+   /**
+    * @brief Creates digest of file or directory.
+    * @param path Path of the file.
+    * @return Hexadecimal digest.
+    * @throws ConfigurationException In case the file can not be read.
+    */
+   static std::string digest(std::string path);
+};
+
+#endif /* RUNCACHE_H_ */
@@ -0,0 +1,135 @@
+/**
+ * @file RunStore.cpp
+ *
+ * Contains implementation of methods of the class RunStore.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "RunStore.h"
+#include "Exceptions/ConfigurationException.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdlib>
+
+/**
+ * Initial size of the file, it is doubled when it is full.
+ */
+static const size_t INITIAL_CAPACITY = 1 << 20;
+
+/**
+ * @brief Constructor creating empty store.
+ * @throws ConfigurationException In case the file can not be created.
+ */
+RunStore::RunStore() :
+      fd(-1), data(NULL), capacity(INITIAL_CAPACITY), end(0), released(0), current(NULL),
+      currentIndex(0) {
+   char fileTemplate[] = "/tmp/analyzerRuns.XXXXXX";
+   fd = mkostemp(fileTemplate, O_CLOEXEC);
+   if (fd < 0)
+      throw ConfigurationException("Creating store of runs failed");
+   // File is removed when it is closed
+   unlink(fileTemplate);
+   void *mapping = MAP_FAILED;
+   if (ftruncate(fd, capacity) == 0)
+      mapping = mmap(NULL, capacity, PROT_READ, MAP_SHARED, fd, 0);
+   if (mapping == MAP_FAILED) {
+      close(fd);
+      throw ConfigurationException("Creating store of runs failed");
+   }
+   data = static_cast<char *>(mapping);
+}
+
+/**
+ * @brief Default destructor.
+ * Removes the file.
+ */
+RunStore::~RunStore() {
+   delete current;
+   munmap(data, capacity);
+   close(fd);
+}
+
+/**
+ * @brief Appends plan to the store.
+ * @param plan Plan to be stored (it is not needed after it is stored).
+ * @throws ConfigurationException In case the file can not be written.
+ */
+void RunStore::add(RunPlan &plan) {
+   std::string text = plan.compose();
+   if (end + text.size() > capacity) {
+      // File and its mapping are enlarged, mapping may be moved
+      size_t newCapacity = capacity;
+      while (end + text.size() > newCapacity)
+         newCapacity *= 2;
+      void *mapping = MAP_FAILED;
+      if (ftruncate(fd, newCapacity) == 0)
+         mapping = mremap(data, capacity, newCapacity, MREMAP_MAYMOVE);
+      if (mapping == MAP_FAILED)
+         throw ConfigurationException("Writing store of runs failed");
+      data = static_cast<char *>(mapping);
+      capacity = newCapacity;
+   }
+   // Plan is written through the file (not the mapping), so full disk is reported as error
+   const char *buf = text.data();
+   size_t left = text.size();
+   while (left > 0) {
+      ssize_t res = pwrite(fd, buf, left, end + text.size() - left);
+      if (res <= 0)
+         throw ConfigurationException("Writing store of runs failed");
+      buf += res;
+      left -= res;
+   }
+   offsets.push_back(end);
+   end += text.size();
+}
+
+/**
+ * @brief Gets plan of the run at given index.
+ * Pages of the file before the plan are released from memory.
+ * @param index Index of the run (must be less than size of the store).
+ * @return Plan of the run, valid until next call of this method.
+ */
+RunPlan *RunStore::get(unsigned index) {
+   if (current != NULL && currentIndex == index)
+      return current;
+   delete current;
+   current = new RunPlan();
+   currentIndex = index;
+   current->parse(getText(index));
+
+   // Runs before the current one have already been expanded
+   size_t pageSize = sysconf(_SC_PAGESIZE);
+   size_t boundary = offsets[index] / pageSize * pageSize;
+   if (boundary > released) {
+      madvise(data + released, boundary - released, MADV_DONTNEED);
+      posix_fadvise(fd, released, boundary - released, POSIX_FADV_DONTNEED);
+      released = boundary;
+   }
+   return current;
+}
+
+/**
+ * @brief Gets text of the plan at given index.
+ * Does not affect the plan returned by ::get nor released pages.
+ * @param index Index of the run (must be less than size of the store).
+ * @return Text of the plan created by RunPlan::compose.
+ */
+std::string RunStore::getText(unsigned index) {
+   size_t planEnd = index + 1 < offsets.size() ? offsets[index + 1] : end;
+   return std::string(data + offsets[index], planEnd - offsets[index]);
+}
+
+/**
+ * @brief Gets number of stored runs.
+ * @return Number of runs.
+ */
+unsigned RunStore::getSize() {
+   return offsets.size();
+}
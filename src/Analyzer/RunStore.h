@@ -0,0 +1,87 @@
+/**
+ * @file RunStore.h
+ *
+ * @brief RunStore class.
+ *
+ * Contains definition of the class RunStore, which keeps plans of saved runs in a memory-mapped
+ * file.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef RUNSTORE_H_
+#define RUNSTORE_H_
+
+#include "Scheduler/RunPlan.h"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Plans of saved runs stored on disk.
+ *
+ * The number of saved runs is not limited, so their plans are not kept in memory. Each plan is
+ * appended (in form created by RunPlan::compose) to a temporary file, which is removed when
+ * the store is destroyed. The file is mapped into memory and only the offsets of the plans are
+ * kept in memory.
+ *
+ * Scheduler walks the runs from the first one to the last one, so only the plan of the run being
+ * expanded is parsed (it is the active window together with the runs appended after it). Pages
+ * of the file before that run are released from memory, as the runs have already been expanded
+ * and they are read again only when a checkpoint is saved.
+ */
+class RunStore {
+public:
+   /**
+    * @brief Constructor creating empty store.
+    * @throws ConfigurationException In case the file can not be created.
+    */
+   RunStore();
+   /**
+    * @brief Default destructor.
+    * Removes the file.
+    */
+   virtual ~RunStore();
+
+   /**
+    * @brief Appends plan to the store.
+    * @param plan Plan to be stored (it is not needed after it is stored).
+    * @throws ConfigurationException In case the file can not be written.
+    */
+   void add(RunPlan &plan);
+   /**
+    * @brief Gets plan of the run at given index.
+    * Pages of the file before the plan are released from memory.
+    * @param index Index of the run (must be less than size of the store).
+    * @return Plan of the run, valid until next call of this method.
+    */
+   RunPlan *get(unsigned index);
+   /**
+    * @brief Gets text of the plan at given index.
+    * Does not affect the plan returned by ::get nor released pages.
+    * @param index Index of the run (must be less than size of the store).
+    * @return Text of the plan created by RunPlan::compose.
+    */
+   std::string getText(unsigned index);
+   /**
+    * @brief Gets number of stored runs.
+    * @return Number of runs.
+    */
+   unsigned getSize();
+protected:
+   int fd; /**< Descriptor of the file */
+   char *data; /**< Mapping of the file */
+   size_t capacity; /**< Size of the file and of the mapping */
+   size_t end; /**< End of the last plan in the file */
+   size_t released; /**< Pages before this offset have been released from memory */
+   std::vector<uint64_t> offsets; /**< Offset of each plan in the file */
+   RunPlan *current; /**< Plan returned by ::get (NULL if there is none) */
+   unsigned currentIndex; /**< Index of ::current */
+};
+
+#endif /* RUNSTORE_H_ */
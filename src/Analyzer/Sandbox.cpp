@@ -0,0 +1,187 @@
+/**
+ * @file Sandbox.cpp
+ *
+ * Contains implementation of methods of the class Sandbox.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Sandbox.h"
+#include "Exceptions/ConfigurationException.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <climits>
+#include <cerrno>
+
+/**
+ * @brief Constructor creating the sandbox.
+ * @param paths Files and directories (relative to working directory) copied into the sandbox.
+ * @throws ConfigurationException In case a path is invalid or it can not be copied.
+ */
+Sandbox::Sandbox(std::vector<std::string> paths) {
+   // Sandbox is created in tmpfs, so files of the runs are not written to disk
+   char shmTemplate[] = "/dev/shm/analyzerSandbox.XXXXXX";
+   char tmpTemplate[] = "/tmp/analyzerSandbox.XXXXXX";
+   char *dir = mkdtemp(shmTemplate);
+   if (dir == NULL)
+      dir = mkdtemp(tmpTemplate);
+   if (dir == NULL)
+      throw ConfigurationException("Creating sandbox directory failed");
+   root = dir;
+
+   for (auto &path : paths) {
+      // Create parent directories of the path
+      for (size_t slash = path.find('/'); slash != std::string::npos;
+            slash = path.find('/', slash + 1)) {
+         mkdir((root + "/" + path.substr(0, slash)).c_str(), 0755);
+      }
+      if (!copy(path, root + "/" + path)) {
+         remove(root);
+         throw ConfigurationException("Copying " + path + " into sandbox failed");
+      }
+   }
+}
+
+/**
+ * @brief Default destructor.
+ * Removes the sandbox with all files created in it.
+ */
+Sandbox::~Sandbox() {
+   remove(root);
+}
+
+/**
+ * @brief Gets root of the sandbox.
+ * @return Path of the directory in which tested program shall be executed.
+ */
+const char *Sandbox::getRoot() {
+   return root.c_str();
+}
+
+/**
+ * @brief Describes state of file or directory (recursively).
+ * Type, size and modification time of each file are described, so the description changes when
+ * a file copied into the sandbox is modified.
+ * @param path Path of the file.
+ * @param result Stream the description is appended to.
+ */
+void Sandbox::describe(std::string path, std::ostream &result) {
+   struct stat st;
+   if (lstat(path.c_str(), &st) != 0) {
+      result << path << " missing\n";
+      return;
+   }
+   result << path << " " << st.st_mode << " " << st.st_size << " " << st.st_mtim.tv_sec << "."
+         << st.st_mtim.tv_nsec << "\n";
+   if (S_ISDIR(st.st_mode)) {
+      DIR *dir = opendir(path.c_str());
+      if (dir == NULL)
+         return;
+      struct dirent *entry;
+      while ((entry = readdir(dir)) != NULL) {
+         std::string name(entry->d_name);
+         if (name != "." && name != "..")
+            describe(path + "/" + name, result);
+      }
+      closedir(dir);
+   }
+}
+
+/**
+ * @brief Copies file or directory (recursively) into the sandbox.
+ * Regular files, directories and symbolic links are copied with their permissions, other types of
+ * files are skipped.
+ * @param source Path of copied file.
+ * @param target Path of the copy.
+ * @return @a true if the copy succeeded, otherwise @a false.
+ */
+bool Sandbox::copy(std::string source, std::string target) {
+   struct stat st;
+   if (lstat(source.c_str(), &st) != 0)
+      return false;
+
+   if (S_ISDIR(st.st_mode)) {
+      // Permissions are set after the content is copied, directory may be read-only
+      if (mkdir(target.c_str(), 0700) != 0 && errno != EEXIST)
+         return false;
+      DIR *dir = opendir(source.c_str());
+      if (dir == NULL)
+         return false;
+      bool result = true;
+      struct dirent *entry;
+      while (result && (entry = readdir(dir)) != NULL) {
+         std::string name(entry->d_name);
+         if (name != "." && name != "..")
+            result = copy(source + "/" + name, target + "/" + name);
+      }
+      closedir(dir);
+      return result && chmod(target.c_str(), st.st_mode & 07777) == 0;
+   }
+   else if (S_ISLNK(st.st_mode)) {
+      char link[PATH_MAX];
+      ssize_t len = readlink(source.c_str(), link, sizeof(link) - 1);
+      if (len < 0)
+         return false;
+      link[len] = '\0';
+      return symlink(link, target.c_str()) == 0;
+   }
+   else if (S_ISREG(st.st_mode)) {
+      int in = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+      if (in < 0)
+         return false;
+      int out = open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, st.st_mode & 07777);
+      if (out < 0) {
+         close(in);
+         return false;
+      }
+      // File is copied inside kernel
+      off_t left = st.st_size;
+      while (left > 0) {
+         ssize_t res = sendfile(out, in, NULL, left);
+         if (res <= 0)
+            break;
+         left -= res;
+      }
+      close(in);
+      close(out);
+      return left == 0;
+   }
+   return true;
+}
+
+/**
+ * @brief Removes file or directory (recursively).
+ * @param path Path to be removed.
+ */
+void Sandbox::remove(std::string path) {
+   struct stat st;
+   if (lstat(path.c_str(), &st) != 0)
+      return;
+   if (S_ISDIR(st.st_mode)) {
+      // Tested program may have removed permissions of the directory
+      chmod(path.c_str(), 0700);
+      DIR *dir = opendir(path.c_str());
+      if (dir != NULL) {
+         struct dirent *entry;
+         while ((entry = readdir(dir)) != NULL) {
+            std::string name(entry->d_name);
+            if (name != "." && name != "..")
+               remove(path + "/" + name);
+         }
+         closedir(dir);
+      }
+      rmdir(path.c_str());
+   }
+   else
+      unlink(path.c_str());
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Sandbox.h
+ *
+ * @brief Sandbox class.
+ *
+ * Contains definition of the class Sandbox, which creates private working directory for a run of
+ * tested program.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef SANDBOX_H_
+#define SANDBOX_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+/**
+ * @brief Private working directory of one run.
+ *
+ * Tested program may modify files in its working directory (e.g. when a fault is injected into
+ * unlink or mkdir), which would change behaviour of the following runs and of the runs executed
+ * concurrently. Therefore files and directories given by option sandbox are copied into a fresh
+ * directory (in tmpfs if available) for each run and tested program is executed in it. Paths
+ * are copied with the same relative path, so relative paths used by tested program are valid in
+ * the sandbox. The directory is removed when the object is destroyed.
+ */
+class Sandbox {
+public:
+   /**
+    * @brief Constructor creating the sandbox.
+    * @param paths Files and directories (relative to working directory) copied into the sandbox.
+    * @throws ConfigurationException In case a path is invalid or it can not be copied.
+    */
+   Sandbox(std::vector<std::string> paths);
+   /**
+    * @brief Default destructor.
+    * Removes the sandbox with all files created in it.
+    */
+   virtual ~Sandbox();
+
+   /**
+    * @brief Gets root of the sandbox.
+    * @return Path of the directory in which tested program shall be executed.
+    */
+   const char *getRoot();
+
+   /**
+    * @brief Describes state of file or directory (recursively).
+    * Type, size and modification time of each file are described, so the description changes
+    * when a file copied into the sandbox is modified.
+    * @param path Path of the file.
+    * @param result Stream the description is appended to.
+    */
+   static void describe(std::string path, std::ostream &result);
+   /**
+    * @brief Removes file or directory (recursively).
+    * @param path Path to be removed.
+    */
+   static void remove(std::string path);
+protected:
+   std::string root; /**< Path of the sandbox directory */
+private:
+   /**
+    * @brief Copies file or directory (recursively) into the sandbox.
+    * Regular files, directories and symbolic links are copied with their permissions, other types
+    * of files are skipped.
+    * @param source Path of copied file.
+    * @param target Path of the copy.
+    * @return @a true if the copy succeeded, otherwise @a false.
+    */
+   static bool copy(std::string source, std::string target);
+};
+
+#endif /* SANDBOX_H_ */
@@ -12,16 +12,19 @@
 
 #include "Scheduler/BFSScheduler.h"
 #include "Controller.h"
+#include "Exceptions/ConfigurationException.h"
+
+#include <cstring>
 
 /**
  * @brief Constructor with members initialization.
  * Calls parent constructor from Scheduler. All indexes are set to 0.
  * @param c Controller pointer.
  * @param groups List of group variants used.
+ * @param msg Initial message with list of functions that are controlled.
  */
-BFSScheduler::BFSScheduler(Controller *c, std::vector<std::string> groups) :
-      Scheduler(c, groups), currentRun(0), currentCall(0), currentVariant(0), currentCallDepth(0), nextCall(
-            false) {
+BFSScheduler::BFSScheduler(Controller *c, std::vector<std::string> groups, InitialMsg *msg) :
+      Scheduler(c, groups, msg), currentRun(0), currentCall(0), currentVariant(0) {
 }
 
 /**
@@ -31,113 +34,76 @@ BFSScheduler::~BFSScheduler() {
 }
 
 /**
- * @brief Schedule call that can be controlled by analyzer.
- * Implements pure virtual method Scheduler::scheduleCall.
- * If call number is same as ::currentCall, does call expansion, which means that it returns
- * outbound message with first variant that has not been tried yet (given by ::currentVariant).
- * If call number is less than ::currentCall (call is before the expanded one), used variant is
- * copied from the run given by ::currentRun.
- * For other calls, use default variant 0 (meaning standard behavior of the call).
- * @param call Call to be scheduled.
- * @param run Actual run of the tested program.
- * @param callNum Number of call in actual run.
- * @return Outbound message with variant number for the call.
+ * @brief Gets next unit (run of tested program) to be executed.
+ * Implements pure virtual method Scheduler::nextUnit.
+ * Creates unit expanding controlled call ::currentCall of run ::currentRun with the first
+ * variant that has not been tried yet (given by ::currentVariant). Call of a function without
+ * variants is expanded once with variant 0, same as in the sequential analysis. After the last
+ * controlled call of the run, switches to next run.
+ * @return Next unit or NULL if there is no next run available yet.
  */
-OutboundMsg *BFSScheduler::scheduleCall(Call *call, Run *run, unsigned callNum) {
-   OutboundMsg *outMsg;
-   if (callNum == currentCall) {
-      // Call where expansion is being done
+WorkUnit *BFSScheduler::nextUnit() {
+   while (currentRun < controller->getRunsCnt()) {
+      // Plan contains only controlled calls after last expanded call (run depth)
+      RunPlan *run = controller->getRun(currentRun);
 
-      // Get next variant (if no variant is available for current function, set it to 0)
-      int variant =
-            currentVariant != variants[call->getFunction()].size() ?
-                  variants[call->getFunction()][currentVariant++] : 0;
-      // Set flow depth to next call (call after expanded one)
-      run->setDepth(currentCall + 1);
-      // Set call variant
-      call->setVariant(variant);
-      // Return message with next variant
-      outMsg = new OutboundMsg(EXEC, call->getName(), variant);
-      if (currentVariant == variants[call->getFunction()].size()) {
-         // After last variant, go to next call in flow
-         nextCall = true;
+      if (currentCall < run->getControlledCnt()) {
+         std::vector<int> &callVariants = variants[run->getControlledFunction(currentCall)];
+         if (currentVariant < callVariants.size()) {
+            // Expand current call with next variant
+            return new WorkUnit(run, run->getControlledCall(currentCall),
+                  callVariants[currentVariant++]);
+         }
+         if (callVariants.empty() && currentVariant == 0) {
+            // Call without variants is expanded once with normal behavior (variant 0)
+            ++currentVariant;
+            return new WorkUnit(run, run->getControlledCall(currentCall), 0);
+         }
+         // After last variant, go to next call in run
+         currentVariant = 0;
+         ++currentCall;
       }
-   }
-   else if (callNum < controller->getRun(currentRun)->getDepth()) {
-      // Calls before expansion call
-
-      // Get variant of corresponding call in current run
-      int variant = controller->getRun(currentRun)->getCall(callNum)->getVariant();
-      // Set call variant
-      call->setVariant(variant);
-      // Send message with same variant as was used in corresponding call
-      outMsg = new OutboundMsg(EXEC, call->getName(), variant);
-
-      //  If the call is last in run, go to next run
-      if (callNum == controller->getRun(currentRun)->getSize() - 1) {
+      else {
+         // After last call in the run, go to next run
          goToNextRun();
       }
    }
-   else {
-      // Calls after expansion call
-
-      // Normal behavior
-      outMsg = new OutboundMsg(EXEC, call->getName(), 0);
-   }
-   return outMsg;
+   return NULL;
 }
 
 /**
- * @brief Inform about call that cannot be controlled.
- * Implements pure virtual method Scheduler::notifCall.
- * Simply goes to the next call (incremets ::currentCall), eventually switches to next run.
- * @param callNum
+ * @brief Gets position of the scheduler.
+ * Implements pure virtual method Scheduler::getPosition.
+ * @return Indexes ::currentRun, ::currentCall and ::currentVariant.
  */
-void BFSScheduler::notifCall(unsigned callNum) {
-   // Flow must not be the first run
-   if (controller->getRunsCnt() != 0) {
-      // In case the call should be expanded, simply go to next call
-      if (callNum == currentCall) {
-         if (++currentCall == controller->getRun(currentRun)->getSize()) {
-            goToNextRun();
-         }
-      }
-   }
+std::string BFSScheduler::getPosition() {
+   unsigned indexes[] = { currentRun, currentCall, currentVariant };
+   return std::string(reinterpret_cast<char *>(indexes), sizeof(indexes));
 }
 
 /**
- * @brief Informs scheduler that next call will be starting new run.
- * Increments ::currentCall in case ::nextCall is true (meaning that all variants for current
- * call have already been tried).
+ * @brief Sets position of the scheduler.
+ * Implements pure virtual method Scheduler::setPosition.
+ * @param position Position returned by ::getPosition.
+ * @throws ConfigurationException In case the position is not valid.
  */
-void BFSScheduler::nextRun() {
-   // If all variants for current call have been used, switch to next call
-   if (nextCall) {
-      nextCall = false;
-      // Next call will start at variant on index 0
-      currentVariant = 0;
-      ++currentCall;
-      // After last call in the run, go to next run
-      if (currentCall == controller->getRun(currentRun)->getSize()) {
-         goToNextRun();
-      }
-   }
+void BFSScheduler::setPosition(const std::string &position) {
+   unsigned indexes[3];
+   if (position.size() != sizeof(indexes))
+      throw ConfigurationException("Invalid position of scheduler");
+   memcpy(indexes, position.data(), sizeof(indexes));
+   currentRun = indexes[0];
+   currentCall = indexes[1];
+   currentVariant = indexes[2];
 }
 
 /**
  * @brief Take next run as model.
- * If there is no next run, end the analysis.
+ * Expansion in next run starts with its first controlled call after its last expanded call
+ * (run depth).
  */
 void BFSScheduler::goToNextRun() {
-   if (++currentRun == controller->getRunsCnt()) {
-      // After last run, end analysis
-      controller->setCompleted();
-   }
-   else {
-      // Switch to next run
-      currentVariant = 0;
-      // In next run, expansion starts after last expanded call (run depth)
-      currentCall = controller->getRun(currentRun)->getDepth();
-   }
+   ++currentRun;
+   currentCall = 0;
+   currentVariant = 0;
 }
-
@@ -22,10 +22,11 @@
  * @brief Scheduler using strategy similar to Breadth-first search.
  * The strategy is based on selecting runs from controller and then for all calls in the run,
  * trying all possible variants. That causes creating new runs, which are then selected.
- * Class keeps indexes of current run, current call in that run and current variant being used
- * for that call. By incrementing those indexes, it tries all possibilities for all calls in all
+ * Class keeps indexes of current run, current controlled call in that run and current variant
+ * being used for that call. By incrementing those indexes, it tries all possibilities for all calls in all
  * runs.
- * Algorithm ends when there is no new run left.
+ * Units created from one model run do not depend on each other, so they can be executed in
+ * parallel. Algorithm ends when there is no new run left.
  * @see Scheduler
  */
 class BFSScheduler: public Scheduler {
@@ -35,53 +36,49 @@ public:
     * Calls parent constructor from Scheduler. All indexes are set to 0.
     * @param c Controller pointer.
     * @param groups List of group variants used.
+    * @param msg Initial message with list of functions that are controlled.
     */
-   BFSScheduler(Controller *c, std::vector<std::string> groups);
+   BFSScheduler(Controller *c, std::vector<std::string> groups, InitialMsg *msg);
    /**
     * @brief Default destructor.
     */
    virtual ~BFSScheduler();
 
    /**
-    * @brief Schedule call that can be controlled by analyzer.
-    * Implements pure virtual method Scheduler::scheduleCall.
-    * If call number is same as ::currentCall, does call expansion, which means that it returns
-    * outbound message with first variant that has not been tried yet (given by ::currentVariant).
-    * If call number is less than ::currentCall (call is before the expanded one), used variant is
-    * copied from the run given by ::currentRun.
-    * For other calls, use default variant 0 (meaning standard behavior of the call).
-    * @param call Call to be scheduled.
-    * @param run Actual run of the tested program.
-    * @param callNum Number of call in actual run.
-    * @return Outbound message with variant number for the call.
+    * @brief Gets next unit (run of tested program) to be executed.
+    * Implements pure virtual method Scheduler::nextUnit.
+    * Creates unit expanding controlled call ::currentCall of run ::currentRun with the first
+    * variant that has not been tried yet (given by ::currentVariant). Call of a function without
+    * variants is expanded once with variant 0, same as in the sequential analysis. After the last
+    * controlled call of the run, switches to next run.
+    * @return Next unit or NULL if there is no next run available yet.
     */
-   OutboundMsg *scheduleCall(Call *call, Run *run, unsigned callNum);
+   WorkUnit *nextUnit();
    /**
-    * @brief Inform about call that cannot be controlled.
-    * Implements pure virtual method Scheduler::notifCall.
-    * Simply goes to the next call (incremets ::currentCall), eventually switches to next run.
-    * @param callNum
+    * @brief Gets position of the scheduler.
+    * Implements pure virtual method Scheduler::getPosition.
+    * @return Indexes ::currentRun, ::currentCall and ::currentVariant.
     */
-   void notifCall(unsigned callNum);
+   std::string getPosition();
    /**
-    * @brief Informs scheduler that next call will be starting new run.
-    * Increments ::currentCall in case ::nextCall is true (meaning that all variants for current
-    * call have already been tried).
+    * @brief Sets position of the scheduler.
+    * Implements pure virtual method Scheduler::setPosition.
+    * @param position Position returned by ::getPosition.
+    * @throws ConfigurationException In case the position is not valid.
     */
-   void nextRun();
+   void setPosition(const std::string &position);
 protected:
    unsigned currentRun; /**< Number of run already received used as model for expansion
                           * (index into vector Controller::runs */
-   unsigned currentCall; /**< Index of call in current run that shall be expanded */
+   unsigned currentCall; /**< Index of controlled call in current run that shall be expanded
+                           * (index into RunPlan::getControlledCall) */
    unsigned currentVariant; /**< Number of variant that will be used for expansion as next
                              * (index into map ::variants */
-   unsigned currentCallDepth; /**< Depth of current run, @see Run::depth */
-   bool nextCall; /**< Boolean meaning that all variants for current call have been used and next
-                   * call should be set in new run */
 private:
    /**
     * @brief Take next run as model.
-    * If there is no next run, end the analysis.
+    * Expansion in next run starts with its first controlled call after its last expanded call
+    * (run depth).
     */
    void goToNextRun();
 };
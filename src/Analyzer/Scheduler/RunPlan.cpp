@@ -0,0 +1,160 @@
+/**
+ * @file RunPlan.cpp
+ *
+ * Contains implementation of methods of the class RunPlan.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Scheduler/RunPlan.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <sstream>
+#include <iostream>
+
+/**
+ * @brief Default constructor.
+ * Creates empty plan, used before parsing.
+ */
+RunPlan::RunPlan() :
+      size(0), depth(0) {
+}
+
+/**
+ * @brief Constructor creating plan from the run.
+ * @param run Run the plan is created from (it is not needed after the plan is created).
+ * @param msg Initial message with list of functions that are controlled.
+ */
+RunPlan::RunPlan(Run *run, InitialMsg *msg) :
+      size(run->getSize()), depth(run->getDepth()) {
+   for (unsigned i = 0; i < size; ++i) {
+      Call call = run->getCall(i);
+      if (i < depth) {
+         if (call.getVariant() != 0)
+            variants.push_back(std::make_pair(i, call.getVariant()));
+      }
+      else if (msg->isControlled(call.getName()))
+         controlled.push_back(std::make_pair(i, call.getFunction()));
+   }
+}
+
+/**
+ * @brief Default destructor.
+ */
+RunPlan::~RunPlan() {
+}
+
+/**
+ * @brief Gets number of calls of the run.
+ * @return Number of calls.
+ */
+unsigned RunPlan::getSize() {
+   return size;
+}
+
+/**
+ * @brief Gets depth of the run.
+ * @return Index of the first call after the expanded one.
+ */
+unsigned RunPlan::getDepth() {
+   return depth;
+}
+
+/**
+ * @brief Gets variants of calls before depth.
+ * @return Vector of pairs (call index, variant), calls with variant 0 are not included.
+ */
+const std::vector<std::pair<unsigned, int> > &RunPlan::getVariants() {
+   return variants;
+}
+
+/**
+ * @brief Gets number of calls after depth that can be controlled.
+ * @return Number of controlled calls.
+ */
+unsigned RunPlan::getControlledCnt() {
+   return controlled.size();
+}
+
+/**
+ * @brief Gets index of controlled call in the run.
+ * @param index Index of the controlled call (in range 0 .. ::getControlledCnt - 1).
+ * @return Index of the call in the run.
+ */
+unsigned RunPlan::getControlledCall(unsigned index) {
+   return controlled[index].first;
+}
+
+/**
+ * @brief Gets function of controlled call.
+ * @param index Index of the controlled call (in range 0 .. ::getControlledCnt - 1).
+ * @return Function of the call.
+ */
+functions RunPlan::getControlledFunction(unsigned index) {
+   return controlled[index].second;
+}
+
+/**
+ * @brief Creates text representation of the plan.
+ * @return Text of the plan in form: @verbatim <size> <depth> <variants count> (<call>
+ * <variant>)* <controlled count> (<call> <function>)*@endverbatim
+ */
+std::string RunPlan::compose() {
+   std::ostringstream msg;
+   msg << size << " " << depth << " " << variants.size();
+   for (auto &v : variants) {
+      msg << " " << v.first << " " << v.second;
+   }
+   msg << " " << controlled.size();
+   for (auto &c : controlled) {
+      msg << " " << c.first << " " << c.second;
+   }
+   return msg.str();
+}
+
+/**
+ * @brief Parses text representation of the plan.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid plan.
+ */
+void RunPlan::parse(std::string msg) {
+   std::istringstream isMsg(msg);
+   size_t cnt;
+   if (!(isMsg >> size >> depth >> cnt))
+      throw ProtocolException("Invalid run plan");
+   variants.clear();
+   for (size_t i = 0; i < cnt; ++i) {
+      unsigned call;
+      int variant;
+      if (!(isMsg >> call >> variant) || call >= depth)
+         throw ProtocolException("Invalid run plan");
+      variants.push_back(std::make_pair(call, variant));
+   }
+   if (!(isMsg >> cnt))
+      throw ProtocolException("Invalid run plan");
+   controlled.clear();
+   for (size_t i = 0; i < cnt; ++i) {
+      unsigned call, function;
+      if (!(isMsg >> call >> function) || call >= size || function > SYNC)
+         throw ProtocolException("Invalid run plan");
+      controlled.push_back(std::make_pair(call, static_cast<functions>(function)));
+   }
+}
+
+/**
+ * @brief Prints the plan.
+ */
+void RunPlan::print() {
+   std::cout << std::endl;
+   std::cout << "Calls: " << size << std::endl;
+   for (auto &v : variants) {
+      std::cout << "Call " << v.first << " variant " << v.second << std::endl;
+   }
+   std::cout << "Depth: " << depth << std::endl;
+   std::cout << "Controlled calls: " << controlled.size() << std::endl;
+   std::cout << std::endl;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file RunPlan.h
+ *
+ * @brief RunPlan class.
+ *
+ * Contains definition of the class RunPlan, which keeps the part of a run needed for scheduling
+ * of following units.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef RUNPLAN_H_
+#define RUNPLAN_H_
+
+#include "Run.h"
+#include "Call.h"
+#include "Parser/InitialMsg.h"
+
+#include <vector>
+#include <string>
+#include <utility>
+
+/**
+ * @brief Saved run of tested program reduced to what the scheduler needs.
+ *
+ * Once a run has been merged into the graph, its calls with parameters and return values are not
+ * needed any more. Scheduler uses the run only as a model for new units, so the plan keeps:
+ * - number of calls and depth of the run,
+ * - variants of calls before depth which differ from normal behavior (variant 0),
+ * - indexes and functions of the calls after depth which can be controlled (only these can be
+ *   expanded).
+ * Both lists are sparse, so the plan is much smaller than the run.
+ */
+class RunPlan {
+public:
+   /**
+    * @brief Default constructor.
+    * Creates empty plan, used before parsing.
+    */
+   RunPlan();
+   /**
+    * @brief Constructor creating plan from the run.
+    * @param run Run the plan is created from (it is not needed after the plan is created).
+    * @param msg Initial message with list of functions that are controlled.
+    */
+   RunPlan(Run *run, InitialMsg *msg);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~RunPlan();
+
+   /**
+    * @brief Gets number of calls of the run.
+    * @return Number of calls.
+    */
+   unsigned getSize();
+   /**
+    * @brief Gets depth of the run.
+    * @return Index of the first call after the expanded one.
+    */
+   unsigned getDepth();
+   /**
+    * @brief Gets variants of calls before depth.
+    * @return Vector of pairs (call index, variant), calls with variant 0 are not included.
+    */
+   const std::vector<std::pair<unsigned, int> > &getVariants();
+   /**
+    * @brief Gets number of calls after depth that can be controlled.
+    * @return Number of controlled calls.
+    */
+   unsigned getControlledCnt();
+   /**
+    * @brief Gets index of controlled call in the run.
+    * @param index Index of the controlled call (in range 0 .. ::getControlledCnt - 1).
+    * @return Index of the call in the run.
+    */
+   unsigned getControlledCall(unsigned index);
+   /**
+    * @brief Gets function of controlled call.
+    * @param index Index of the controlled call (in range 0 .. ::getControlledCnt - 1).
+    * @return Function of the call.
+    */
+   functions getControlledFunction(unsigned index);
+
+   /**
+    * @brief Creates text representation of the plan.
+    * @return Text of the plan in form: @verbatim <size> <depth> <variants count> (<call>
+    * <variant>)* <controlled count> (<call> <function>)*@endverbatim
+    */
+   std::string compose();
+   /**
+    * @brief Parses text representation of the plan.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid plan.
+    */
+   void parse(std::string msg);
+   /**
+    * @brief Prints the plan.
+    */
+   void print();
+protected:
+   unsigned size; /**< Number of calls of the run */
+   unsigned depth; /**< Depth of the run */
+   std::vector<std::pair<unsigned, int> > variants; /**< Non-zero variants of calls before depth */
+   std::vector<std::pair<unsigned, functions> > controlled; /**< Controlled calls after depth */
+};
+
+#endif /* RUNPLAN_H_ */
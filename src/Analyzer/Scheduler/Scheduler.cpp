@@ -20,19 +20,23 @@
  * only those variant groups that are given.
  * @param c Pointer to controller.
  * @param groups Vector of variant group names that shall be used during analysis.
+ * @param msg Initial message with list of functions that are controlled.
  * @throws ConfigurationException if one of groups given has invalid syntax or is not supported
  */
-Scheduler::Scheduler(Controller *c, std::vector<std::string> groups) :
-      controller(c) {
+Scheduler::Scheduler(Controller *c, std::vector<std::string> groups, InitialMsg *msg) :
+      controller(c), initMsg(msg) {
    // Iterate all functions
    for (const auto & fun : variationsMap) {
       // Iterate all given groups
       for (auto grpStr : groups) {
-         if (strToGroup.find(grpStr) != strToGroup.end()) {
-            varGroups group = strToGroup[grpStr];
+         auto groupIt = strToGroup.find(grpStr);
+         if (groupIt != strToGroup.end()) {
             // Copy all variants for the function and group into variants map
-            for (auto var : variationsMap[fun.first][group]) {
-               variants[fun.first].push_back(var);
+            auto varIt = fun.second.find(groupIt->second);
+            if (varIt != fun.second.end()) {
+               for (auto var : varIt->second) {
+                  variants[fun.first].push_back(var);
+               }
             }
          }
          else
@@ -16,7 +16,8 @@
 #ifndef SCHEDULER_H_
 #define SCHEDULER_H_
 
-#include "Parser/OutboundMsg.h"
+#include "Parser/InitialMsg.h"
+#include "Scheduler/WorkUnit.h"
 #include "Call.h"
 #include "Run.h"
 
@@ -68,34 +69,37 @@ public:
     * only those variant groups that are given.
     * @param c Pointer to controller.
     * @param groups Vector of variant group names that shall be used during analysis.
+    * @param msg Initial message with list of functions that are controlled.
     */
-   Scheduler(Controller *c, std::vector<std::string> groups);
+   Scheduler(Controller *c, std::vector<std::string> groups, InitialMsg *msg);
    /**
     * @brief Default destructor.
     */
    virtual ~Scheduler();
 
    /**
-    * @brief Create reaction to call that can be controlled by analyzer.
-    * Used for calls that arrived in message of type CONTROL.
-    * @param call Call to be scheduled.
-    * @param run Current run of tested program.
-    * @param callNum Number of call in current run.
-    * @return Outbound message containing variant of the call that is to be run by tested program.
+    * @brief Gets next unit (run of tested program) to be executed.
+    * Units are returned in the order in which the results of their execution must be processed.
+    * @return Next unit or NULL if no unit can be scheduled until results of already scheduled
+    * units are processed (or there is no unit left at all).
     */
-   virtual OutboundMsg *scheduleCall(Call *call, Run *run, unsigned callNum) = 0;
+   virtual WorkUnit *nextUnit() = 0;
    /**
-    * @brief Nofitication about a call that cannot be controlled.
-    * Used for calls that arrived in message of type NOTIFY.
-    * @param callNum Number of the call in current run of tested program.
+    * @brief Gets position of the scheduler.
+    * Position determines which units are created next, so that scheduling can continue from it
+    * when the analysis is resumed.
+    * @return Binary representation of the position.
     */
-   virtual void notifCall(unsigned callNum) = 0;
+   virtual std::string getPosition() = 0;
    /**
-    * @brief Informs scheduler that next call will be starting new run.
+    * @brief Sets position of the scheduler.
+    * @param position Position returned by ::getPosition.
+    * @throws ConfigurationException In case the position is not valid.
     */
-   virtual void nextRun() = 0;
+   virtual void setPosition(const std::string &position) = 0;
 protected:
    Controller *controller; /**< Pointer to the controller where the scheduler has been created */
+   InitialMsg *initMsg; /**< Initial message with list of functions that are controlled */
    /**
     * Map mapping functions to the list of variants that will be used in current analysis.
     */
@@ -0,0 +1,174 @@
+/**
+ * @file WorkUnit.cpp
+ *
+ * Contains implementation of methods of the class WorkUnit.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Scheduler/WorkUnit.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <sstream>
+
+/**
+ * @brief Default constructor.
+ * Creates unit of the initial run, where no call is expanded (all calls are performed normally).
+ */
+WorkUnit::WorkUnit() :
+      prefix(), expand(false), call(0), variant(0), fragment(NULL), error() {
+}
+
+/**
+ * @brief Constructor with members initialization.
+ * Copies variants of calls before depth of the model run.
+ * @param model Plan of the run used as model for the new run.
+ * @param c Number of the call to be expanded.
+ * @param v Variant used for the expanded call.
+ */
+WorkUnit::WorkUnit(RunPlan *model, unsigned c, int v) :
+      prefix(model->getDepth(), 0), expand(true), call(c), variant(v), fragment(NULL), error() {
+   for (auto &callVariant : model->getVariants()) {
+      prefix[callVariant.first] = callVariant.second;
+   }
+}
+
+/**
+ * @brief Default destructor.
+ */
+WorkUnit::~WorkUnit() {
+}
+
+/**
+ * @brief Schedule call that can be controlled by analyzer.
+ * If call number is same as expanded call, sets run depth to the next call and uses variant of
+ * the unit. Calls before depth of the model run use the same variants as in model run. Other
+ * calls use default variant 0 (meaning standard behavior of the call).
+ * @param c Call to be scheduled.
+ * @param run Actual run of the tested program.
+ * @param callNum Number of call in actual run.
+ * @return Outbound message with variant number for the call.
+ */
+OutboundMsg *WorkUnit::scheduleCall(Call c, Run *run, unsigned callNum) {
+   int v = 0;
+   if (expand && callNum == call) {
+      // Call where expansion is being done
+      v = variant;
+      // Set run depth to next call (call after expanded one)
+      run->setDepth(call + 1);
+   }
+   else if (callNum < prefix.size()) {
+      // Calls before expansion call use same variant as corresponding call in model run
+      v = prefix[callNum];
+   }
+   // Set call variant
+   c.setVariant(v);
+   return new OutboundMsg(EXEC, c.getName(), v);
+}
+
+/**
+ * @brief Checks if the unit is the initial run.
+ * @return @a True if no call is expanded in the unit, otherwise @a false.
+ */
+bool WorkUnit::isInitial() {
+   return !expand;
+}
+
+/**
+ * @brief Gets the first call whose behavior is changed by the unit.
+ * Until this call, the run follows the initial run.
+ * @return Index of the call or -1 if the unit does not change behavior of any call.
+ */
+int WorkUnit::getFirstAffectedCall() {
+   for (unsigned i = 0; i < prefix.size(); ++i) {
+      if (prefix[i] != 0)
+         return i;
+   }
+   return expand ? call : -1;
+}
+
+/**
+ * @brief Creates text representation of the unit.
+ * Only the plan of the run is written (not the result of its execution), so the unit can be sent
+ * to a worker process.
+ * @return Text of the unit in form: @verbatim <expand> <call> <variant> <prefix size> <prefix
+ * variants>@endverbatim
+ */
+std::string WorkUnit::compose() {
+   std::ostringstream msg;
+   msg << expand << " " << call << " " << variant << " " << prefix.size();
+   for (auto v : prefix) {
+      msg << " " << v;
+   }
+   return msg.str();
+}
+
+/**
+ * @brief Parses text representation of the unit.
+ * @param msg Text created by ::compose.
+ * @throws ProtocolException In case the text is not a valid unit.
+ */
+void WorkUnit::parse(std::string msg) {
+   std::istringstream isMsg(msg);
+   unsigned prefixSize;
+   if (!(isMsg >> expand >> call >> variant >> prefixSize))
+      throw ProtocolException("Invalid work unit");
+   prefix.resize(prefixSize);
+   for (auto &v : prefix) {
+      if (!(isMsg >> v))
+         throw ProtocolException("Invalid work unit");
+   }
+}
+
+/**
+ * @brief Sets result of the unit execution.
+ * @param f Fragment created from the run.
+ */
+void WorkUnit::setFragment(RunFragment *f) {
+   fragment = f;
+}
+
+/**
+ * @brief Gets result of the unit execution.
+ * @return Fragment created from the run or NULL if the unit has not been executed yet.
+ */
+RunFragment *WorkUnit::getFragment() {
+   return fragment;
+}
+
+/**
+ * @brief Sets exception thrown during unit execution.
+ * @param e Pointer to the exception.
+ */
+void WorkUnit::setError(std::exception_ptr e) {
+   error = e;
+}
+
+/**
+ * @brief Gets exception thrown during unit execution.
+ * @return Pointer to the exception or null pointer if execution succeeded.
+ */
+std::exception_ptr WorkUnit::getError() {
+   return error;
+}
+
+/**
+ * @brief Sets position of the scheduler after the unit has been created.
+ * @param p Position returned by Scheduler::getPosition.
+ */
+void WorkUnit::setPosition(const std::string &p) {
+   position = p;
+}
+
+/**
+ * @brief Gets position of the scheduler after the unit has been created.
+ * Analysis resumed from this position continues with the unit following this one.
+ * @return Position of the scheduler (empty if it has not been set).
+ */
+const std::string &WorkUnit::getPosition() {
+   return position;
+}
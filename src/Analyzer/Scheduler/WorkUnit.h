@@ -0,0 +1,139 @@
+/**
+ * @file WorkUnit.h
+ *
+ * @brief WorkUnit class.
+ *
+ * Contains definition of the class WorkUnit, which describes one run of the tested program that
+ * is to be executed.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef WORKUNIT_H_
+#define WORKUNIT_H_
+
+#include "Parser/OutboundMsg.h"
+#include "Call.h"
+#include "Run.h"
+#include "Scheduler/RunPlan.h"
+
+#include <vector>
+#include <string>
+#include <exception>
+
+// Forward declaration of class RunFragment (for linker)
+class RunFragment;
+
+/**
+ * @brief One run of tested program planned by scheduler.
+ *
+ * Unit is self-contained: it holds variants of all calls before the expanded call (copied from
+ * the model run), the expanded call number and the variant used for it. All other calls are
+ * performed with normal behavior (variant 0). Thanks to this, units can be executed
+ * independently of each other, e.g. by different workers at the same time.
+ * After the unit is executed, it holds the result of the execution (fragment with the run).
+ */
+class WorkUnit {
+public:
+   /**
+    * @brief Default constructor.
+    * Creates unit of the initial run, where no call is expanded (all calls are performed normally).
+    */
+   WorkUnit();
+   /**
+    * @brief Constructor with members initialization.
+    * Copies variants of calls before depth of the model run.
+    * @param model Plan of the run used as model for the new run.
+    * @param c Number of the call to be expanded.
+    * @param v Variant used for the expanded call.
+    */
+   WorkUnit(RunPlan *model, unsigned c, int v);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~WorkUnit();
+
+   /**
+    * @brief Schedule call that can be controlled by analyzer.
+    * If call number is same as expanded call, sets run depth to the next call and uses variant of
+    * the unit. Calls before depth of the model run use the same variants as in model run. Other
+    * calls use default variant 0 (meaning standard behavior of the call).
+    * @param call Call to be scheduled.
+    * @param run Actual run of the tested program.
+    * @param callNum Number of call in actual run.
+    * @return Outbound message with variant number for the call.
+    */
+   OutboundMsg *scheduleCall(Call call, Run *run, unsigned callNum);
+
+   /**
+    * @brief Checks if the unit is the initial run.
+    * @return @a True if no call is expanded in the unit, otherwise @a false.
+    */
+   bool isInitial();
+   /**
+    * @brief Gets the first call whose behavior is changed by the unit.
+    * Until this call, the run follows the initial run.
+    * @return Index of the call or -1 if the unit does not change behavior of any call.
+    */
+   int getFirstAffectedCall();
+   /**
+    * @brief Creates text representation of the unit.
+    * Only the plan of the run is written (not the result of its execution), so the unit can be
+    * sent to a worker process.
+    * @return Text of the unit in form: @verbatim <expand> <call> <variant> <prefix size> <prefix
+    * variants>@endverbatim
+    */
+   std::string compose();
+   /**
+    * @brief Parses text representation of the unit.
+    * @param msg Text created by ::compose.
+    * @throws ProtocolException In case the text is not a valid unit.
+    */
+   void parse(std::string msg);
+
+   /**
+    * @brief Sets result of the unit execution.
+    * @param f Fragment created from the run.
+    */
+   void setFragment(RunFragment *f);
+   /**
+    * @brief Gets result of the unit execution.
+    * @return Fragment created from the run or NULL if the unit has not been executed yet.
+    */
+   RunFragment *getFragment();
+   /**
+    * @brief Sets exception thrown during unit execution.
+    * @param e Pointer to the exception.
+    */
+   void setError(std::exception_ptr e);
+   /**
+    * @brief Gets exception thrown during unit execution.
+    * @return Pointer to the exception or null pointer if execution succeeded.
+    */
+   std::exception_ptr getError();
+   /**
+    * @brief Sets position of the scheduler after the unit has been created.
+    * @param p Position returned by Scheduler::getPosition.
+    */
+   void setPosition(const std::string &p);
+   /**
+    * @brief Gets position of the scheduler after the unit has been created.
+    * Analysis resumed from this position continues with the unit following this one.
+    * @return Position of the scheduler (empty if it has not been set).
+    */
+   const std::string &getPosition();
+protected:
+   std::vector<int> prefix; /**< Variants of calls before depth of the model run */
+   bool expand; /**< True if a call shall be expanded */
+   unsigned call; /**< Number of call to be expanded */
+   int variant; /**< Variant used for expanded call */
+   RunFragment *fragment; /**< Result of the execution */
+   std::exception_ptr error; /**< Exception thrown during execution */
+   std::string position; /**< Position of the scheduler after the unit has been created */
+};
+
+#endif /* WORKUNIT_H_ */
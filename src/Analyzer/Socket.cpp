@@ -14,14 +14,27 @@
 #include "Exceptions/SocketException.h"
 #include "Exceptions/SocketClosedException.h"
 #include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
 
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <cstring>
+#include <cstdlib>
 #include <unistd.h>
 #include <errno.h>
 #include <sys/time.h>
+#include <poll.h>
+
+/**
+ * Maximal length of a message from tested program (calls have at most 5 parameters, each one
+ * at most as long as a path).
+ */
+static const size_t MAX_MSG_SIZE = 1 << 20;
+/**
+ * Maximal length of the length prefix of a message.
+ */
+static const size_t MAX_HEADER_SIZE = 20;
 
 /**
  * @brief Constructor with specification of the named socket destination.
@@ -31,9 +44,9 @@
  * @throws SocketException In case socket creating or binding fails.
  */
 Socket::Socket(std::string s) :
-      clientSocket(0) {
-   // Create welcome socket
-   if ((welcomeSocket = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+      path(s), clientSocket(-1) {
+   // Create welcome socket (tested programs started by other workers must not inherit it)
+   if ((welcomeSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0) {
       throw SocketException("Creating socket failed");
    }
    // Create structure containing socket address
@@ -54,8 +67,10 @@ Socket::Socket(std::string s) :
 
 /**
  * @brief Default destructor.
+ * Removes the named socket file.
  */
 Socket::~Socket() {
+   unlink(path.c_str());
 }
 
 /**
@@ -79,10 +94,11 @@ void Socket::acceptConnection() {
    // Wait for connection with timeout
    int selectedSockets = select(welcomeSocket + 1, &readfds, NULL, NULL, &tv);
    if (selectedSockets > 0) {
-      // Accept connection
-      if ((clientSocket = accept(welcomeSocket, NULL, NULL)) == -1) {
+      // Accept connection (client socket is not inherited by tested programs either)
+      if ((clientSocket = accept4(welcomeSocket, NULL, NULL, SOCK_CLOEXEC)) == -1) {
          throw SocketException("Accepting connection failed");
       }
+      buffer.clear();
    }
    else if (selectedSockets == 0)
       // Timeout expired
@@ -108,17 +124,45 @@ void Socket::sendMsg(std::string msg) {
 
 /**
  * @brief Receive message from socket.
+ * Messages from tested program are prefixed by their length and newline.
  * @return Message received.
  * @throws SocketClosedException In case the socket has been closed by other side.
+ * @throws SocketException In case an error occured during receiving.
+ * @throws ProtocolException In case the length of the message is not valid.
  */
 std::string Socket::recvMsg() {
-   char buf[250];
-   if (recv(clientSocket, buf, 250, 0) != 0) {
-      std::string msg(buf);
-      return msg;
+   size_t headerEnd;
+   while ((headerEnd = buffer.find('\n')) == std::string::npos) {
+      if (buffer.size() > MAX_HEADER_SIZE)
+         throw ProtocolException("Invalid length of message");
+      receive();
    }
-   else
+   char *end;
+   unsigned long size = strtoul(buffer.c_str(), &end, 10);
+   if (headerEnd == 0 || end != buffer.c_str() + headerEnd || size > MAX_MSG_SIZE)
+      throw ProtocolException("Invalid length of message");
+   while (buffer.size() < headerEnd + 1 + size)
+      receive();
+   std::string msg = buffer.substr(headerEnd + 1, size);
+   buffer.erase(0, headerEnd + 1 + size);
+   return msg;
+}
+
+/**
+ * @brief Receives available data from client socket into ::buffer.
+ * @throws SocketClosedException In case the socket has been closed by other side.
+ * @throws SocketException In case an error occured during receiving.
+ */
+void Socket::receive() {
+   char buf[4096];
+   ssize_t res;
+   while ((res = recv(clientSocket, buf, sizeof(buf), 0)) < 0 && errno == EINTR)
+      ;
+   if (res == 0 || (res < 0 && errno == ECONNRESET))
       throw SocketClosedException();
+   if (res < 0)
+      throw SocketException("Receiving the message failed");
+   buffer.append(buf, res);
 }
 
 /**
@@ -132,5 +176,34 @@ void Socket::closeWelcomeSocket() {
  * @brief Closes client socket.
  */
 void Socket::closeClientSocket() {
-   close(clientSocket);
+   if (clientSocket >= 0) {
+      close(clientSocket);
+      clientSocket = -1;
+   }
+   buffer.clear();
+}
+
+/**
+ * @brief Closes connections waiting to be accepted.
+ * Used when a tested program is terminated before its connection is accepted, so that the
+ * connection is not accepted instead of connection of the next tested program.
+ */
+void Socket::discardConnections() {
+   struct pollfd pfd;
+   pfd.fd = welcomeSocket;
+   pfd.events = POLLIN;
+   while (poll(&pfd, 1, 0) > 0) {
+      int fd = accept4(welcomeSocket, NULL, NULL, SOCK_CLOEXEC);
+      if (fd < 0)
+         break;
+      close(fd);
+   }
+}
+
+/**
+ * @brief Gets destination of the named socket.
+ * @return Path to the socket file.
+ */
+std::string Socket::getPath() {
+   return path;
 }
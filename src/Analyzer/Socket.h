@@ -37,6 +37,7 @@ public:
    Socket(std::string s);
    /**
     * @brief Default destructor.
+    * Removes the named socket file.
     */
    virtual ~Socket();
 
@@ -59,7 +60,11 @@ public:
    void sendMsg(std::string msg);
    /**
     * @brief Receive message from socket.
+    * Messages from tested program are prefixed by their length and newline.
     * @return Message received.
+    * @throws SocketClosedException In case the socket has been closed by other side.
+    * @throws SocketException In case an error occured during receiving.
+    * @throws ProtocolException In case the length of the message is not valid.
     */
    std::string recvMsg();
    /**
@@ -70,9 +75,29 @@ public:
     * @brief Closes client socket.
     */
    void closeClientSocket();
+   /**
+    * @brief Closes connections waiting to be accepted.
+    * Used when a tested program is terminated before its connection is accepted, so that the
+    * connection is not accepted instead of connection of the next tested program.
+    */
+   void discardConnections();
+   /**
+    * @brief Gets destination of the named socket.
+    * @return Path to the socket file.
+    */
+   std::string getPath();
 protected:
+   std::string path; /**< File destination of the named socket. */
    int welcomeSocket; /**< Welcome socket used for accepting connection request. */
    int clientSocket; /**< Socket where the communication is performed. */
+   std::string buffer; /**< Received data not processed yet. */
+
+   /**
+    * @brief Receives available data from client socket into ::buffer.
+    * @throws SocketClosedException In case the socket has been closed by other side.
+    * @throws SocketException In case an error occured during receiving.
+    */
+   void receive();
 };
 
 #endif /* SOCKET_H_ */
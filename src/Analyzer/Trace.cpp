@@ -11,6 +11,11 @@
  */
 
 #include "Trace.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
 
 /**
  * @brief Default constructor.
@@ -27,10 +32,38 @@ Trace::~Trace() {
 
 /**
  * @brief Add call to the end of the trace.
- * @param call Pointer to the call to be added.
+ * The call has no parameters, empty return value and variant 0.
+ * @param name Name of the called function.
+ * @param size Length of the name.
+ * @return The call added.
  */
-void Trace::nextCall(Call *c) {
-   calls.push_back(c);
+Call Trace::addCall(const char *name, size_t size) {
+   names.push_back(addString(name, size));
+   functionIds.push_back(Call::findFunction(std::string(name, size)));
+   variants.push_back(0);
+   paramsBegin.push_back(params.size());
+   returnValues.push_back(parseValue("", 0));
+   return Call(this, functionIds.size() - 1);
+}
+
+/**
+ * @brief Adds parameter to the last call of the trace.
+ * @param value Value of the parameter in typed encoding (see Param).
+ * @param size Length of the value.
+ * @throws ProtocolException In case the type of the value is unknown.
+ */
+void Trace::addParam(const char *value, size_t size) {
+   params.push_back(parseValue(value, size));
+}
+
+/**
+ * @brief Sets return value of the last call of the trace.
+ * @param value Return value in typed encoding (see Param), empty if there is no value.
+ * @param size Length of the value.
+ * @throws ProtocolException In case the type of the value is unknown.
+ */
+void Trace::setReturnVal(const char *value, size_t size) {
+   returnValues.back() = parseValue(value, size);
 }
 
 /**
@@ -38,22 +71,114 @@ void Trace::nextCall(Call *c) {
  * @return Size of the trace.
  */
 unsigned Trace::getSize() {
-   return calls.size();
+   return functionIds.size();
+}
+
+/**
+ * @brief Gets the call at given index.
+ * @param index Index of the call to get (must be less than size of the trace).
+ * @return View of the call.
+ */
+Call Trace::getCall(unsigned index) {
+   return Call(this, index);
+}
+
+/**
+ * @brief Stores string into the arena.
+ * @param str String to be stored.
+ * @param size Length of the string.
+ * @return Position of the string in the arena.
+ */
+Trace::TStrRef Trace::addString(const char *str, size_t size) {
+   TStrRef ref(strings.size(), size);
+   strings.append(str, size);
+   return ref;
+}
+
+/**
+ * @brief Gets string from the arena.
+ * @param ref Position of the string in the arena.
+ * @return Copy of the string.
+ */
+std::string Trace::getString(TStrRef ref) {
+   return strings.substr(ref.first, ref.second);
+}
+
+/**
+ * @brief Converts value in typed encoding.
+ * Strings are interned.
+ * @param value Value in typed encoding (see Param).
+ * @param size Length of the value.
+ * @return Typed value.
+ * @throws ProtocolException In case the type of the value is unknown.
+ */
+Trace::TValue Trace::parseValue(const char *value, size_t size) {
+   TValue result;
+   // Value without type is an empty string (e.g. return value of void function)
+   if (size == 0 || value[0] == 's') {
+      result.type = PT_STRING;
+      result.number = size > 0 ? intern(value + 1, size - 1) : intern("", 0);
+      return result;
+   }
+
+   // Number is copied, because the value does not have to be terminated
+   char number[32];
+   size_t len = std::min(size - 1, sizeof(number) - 1);
+   memcpy(number, value + 1, len);
+   number[len] = '\0';
+   switch (value[0]) {
+   case 'd':
+      result.type = PT_INT;
+      result.number = strtoll(number, NULL, 10);
+      break;
+   case 'u':
+      result.type = PT_UINT;
+      result.number = strtoull(number, NULL, 10);
+      break;
+   case 'p':
+      // NULL pointer is printed as (nil), which is converted to 0
+      result.type = PT_POINTER;
+      result.number = strtoull(number, NULL, 16);
+      break;
+   case 'o':
+      result.type = PT_MODE;
+      result.number = strtoull(number, NULL, 8);
+      break;
+   default:
+      throw ProtocolException("Unknown type of value");
+   }
+   return result;
 }
 
 /**
- * @brief Gets the pointer to the call at given index.
- * @param index Index of the call to get.
- * @return Pointer to the call or NULL if index is beyond size of the trace.
+ * @brief Finds string in ::interned or adds it there.
+ * @param str String to be interned.
+ * @param size Length of the string.
+ * @return Index of the string in ::interned.
  */
-Call *Trace::getCall(unsigned index) {
-   return calls[index];
+unsigned Trace::intern(const char *str, size_t size) {
+   // 64-bit FNV-1a hash
+   uint64_t hash = 14695981039346656037ULL;
+   for (size_t i = 0; i < size; ++i) {
+      hash ^= (unsigned char) str[i];
+      hash *= 1099511628211ULL;
+   }
+   auto range = internedIndex.equal_range(hash);
+   for (auto it = range.first; it != range.second; ++it) {
+      TStrRef ref = interned[it->second];
+      if (ref.second == size && strings.compare(ref.first, size, str, size) == 0)
+         return it->second;
+   }
+   interned.push_back(addString(str, size));
+   internedIndex.insert(std::make_pair(hash, interned.size() - 1));
+   return interned.size() - 1;
 }
 
 /**
- * @brief Gets the vector of calls in the trace.
- * @return Vector of calls.
+ * @brief Gets end of parameters of the call in ::params.
+ * @param index Index of the call.
+ * @return Index after the last parameter of the call.
  */
-std::vector<Call *> Trace::getCalls() {
-   return calls;
+unsigned Trace::paramsEnd(unsigned index) {
+   return index + 1 < paramsBegin.size() ? paramsBegin[index + 1] : params.size();
 }
@@ -18,12 +18,21 @@
 #include "Call.h"
 
 #include <vector>
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <cstdint>
 
 /**
  * @brief Trace in the tested program.
  *
  * Class representing a trace, which means a sequence of successive calls as they are called by
  * tested program.
+ * Calls are stored in columns (function, variant, name, parameters and return value of each call)
+ * and all their strings are stored in one arena, so adding a call does not allocate memory except
+ * when a column grows. Class Call is a view of one call in the columns.
+ * Parameters and return values are typed (see Param), numbers are stored directly in the columns
+ * and strings (mostly paths) are interned, so a path used by many calls is stored only once.
  */
 class Trace {
 public:
@@ -39,28 +48,107 @@ public:
 
    /**
     * @brief Add call to the end of the trace.
-    * @param call Pointer to the call to be added.
+    * The call has no parameters, empty return value and variant 0.
+    * @param name Name of the called function.
+    * @param size Length of the name.
+    * @return The call added.
     */
-   void nextCall(Call *call);
+   Call addCall(const char *name, size_t size);
+   /**
+    * @brief Adds parameter to the last call of the trace.
+    * @param value Value of the parameter in typed encoding (see Param).
+    * @param size Length of the value.
+    * @throws ProtocolException In case the type of the value is unknown.
+    */
+   void addParam(const char *value, size_t size);
+   /**
+    * @brief Sets return value of the last call of the trace.
+    * @param value Return value in typed encoding (see Param), empty if there is no value.
+    * @param size Length of the value.
+    * @throws ProtocolException In case the type of the value is unknown.
+    */
+   void setReturnVal(const char *value, size_t size);
    /**
     * @brief Gets the size of the trace (number of calls).
     * @return Size of the trace.
     */
    unsigned getSize();
    /**
-    * @brief Gets the pointer to the call at given index.
-    * @param index Index of the call to get.
-    * @return Pointer to the call or NULL if index is beyond size of the trace.
+    * @brief Gets the call at given index.
+    * @param index Index of the call to get (must be less than size of the trace).
+    * @return View of the call.
     */
-   Call *getCall(unsigned index);
+   Call getCall(unsigned index);
+
+protected:
    /**
-    * @brief Gets the vector of calls in the trace.
-    * @return Vector of calls.
+    * Position of a string in ::strings (offset and length).
     */
-   std::vector<Call *> getCalls();
+   typedef std::pair<unsigned, unsigned> TStrRef;
 
-protected:
-   std::vector<Call *> calls; /**< Vector of calls in the trace */
+   /**
+    * Typed value of a parameter or a return value.
+    */
+   typedef struct {
+      paramTypes type; /**< Type of the value */
+      int64_t number; /**< Number or index of the string in ::interned */
+   } TValue;
+
+   std::string strings; /**< Arena containing all strings of the calls */
+   std::vector<functions> functionIds; /**< Function of each call */
+   std::vector<int> variants; /**< Variant used for each call */
+   std::vector<TStrRef> names; /**< Function name of each call */
+   std::vector<unsigned> paramsBegin; /**< Index of the first parameter of each call in ::params */
+   std::vector<TValue> params; /**< Parameters of all calls */
+   std::vector<TValue> returnValues; /**< Return value of each call */
+   std::vector<TStrRef> interned; /**< Distinct string values of the trace */
+   std::unordered_multimap<uint64_t, unsigned> internedIndex; /**< Indexes of ::interned by hash
+                                                               * of the string */
+
+   /**
+    * @brief Stores string into the arena.
+    * @param str String to be stored.
+    * @param size Length of the string.
+    * @return Position of the string in the arena.
+    */
+   TStrRef addString(const char *str, size_t size);
+   /**
+    * @brief Gets string from the arena.
+    * @param ref Position of the string in the arena.
+    * @return Copy of the string.
+    */
+   std::string getString(TStrRef ref);
+   /**
+    * @brief Converts value in typed encoding.
+    * Strings are interned.
+    * @param value Value in typed encoding (see Param).
+    * @param size Length of the value.
+    * @return Typed value.
+    * @throws ProtocolException In case the type of the value is unknown.
+    */
+   TValue parseValue(const char *value, size_t size);
+   /**
+    * @brief Finds string in ::interned or adds it there.
+    * @param str String to be interned.
+    * @param size Length of the string.
+    * @return Index of the string in ::interned.
+    */
+   unsigned intern(const char *str, size_t size);
+   /**
+    * @brief Gets end of parameters of the call in ::params.
+    * @param index Index of the call.
+    * @return Index after the last parameter of the call.
+    */
+   unsigned paramsEnd(unsigned index);
+
+   /**
+    * Call is a friend class because it is a view of the columns.
+    */
+   friend class Call;
+   /**
+    * Param is a friend class because it is a view of a value in the columns.
+    */
+   friend class Param;
 };
 
 #endif /* TRACE_H_ */
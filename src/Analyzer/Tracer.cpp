@@ -20,95 +20,129 @@
 #include <unistd.h>
 #include <cstdlib>
 #include <string>
+#include <sstream>
 #include <sys/wait.h>
 #include <cstring>
 #include <iostream>
 #include <sys/types.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <spawn.h>
+#include <signal.h>
+
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 34)
+/**
+ * @brief Tested program is started by posix_spawn().
+ * Requires file actions for changing directory and closing descriptors (glibc 2.34).
+ */
+#define TRACER_SPAWN
+#endif
+
+#ifndef TRACER_SPAWN
+/**
+ * @brief Closes all descriptors except standard input, output and error output.
+ * Called in the child process before tested program is executed, thus uses only system calls.
+ */
+static void closeDescriptors() {
+#ifdef SYS_close_range
+   if (syscall(SYS_close_range, 3, ~0U, 0) == 0)
+      return;
+#endif
+   long maxFd = sysconf(_SC_OPEN_MAX);
+   for (long fd = 3; fd < maxFd; ++fd) {
+      close(fd);
+   }
+}
+#endif
 
 /**
  * @brief Constructor with members initialization.
- * Initializes pointers to socket and controller. Also converts given vector of string with
- * tested program name and parameters into array of @a char*.
+ * Initializes pointers to socket and configuration. Arguments of tested program are taken from
+ * the configuration and its environment is given by the worker, so both are created only once and
+ * not for each run.
  * @param s Pointer to the Socket object used for communication.
- * @param c Pointer to the Controller object which created this Tracer.
- * @param prog Vector of strings with tested program destination and parameters.
+ * @param c Configuration of the analysis (contains tested program and its arguments).
+ * @param env Environment of tested program (NULL-terminated array).
  */
-Tracer::Tracer(Socket *s, Controller *c, std::vector<std::string> prog) :
-      callNum(0), socket(s), controller(c), programArgsSize(prog.size()) {
-
-   // Create array of c-string from vector of std::string
-   programArgs = new char*[programArgsSize + 1]();
-   for (unsigned i = 0; i < programArgsSize; ++i) {
-      programArgs[i] = new char[100]();
-      strcpy(programArgs[i], prog[i].c_str());
-   }
-   // Last member of the array must be NULL, because it will be used in execv() function
-   programArgs[programArgsSize] = NULL;
+Tracer::Tracer(Socket *s, Configuration *c, char *const *env) :
+      callNum(0), socket(s), config(c), unit(NULL), process(0), programEnv(env), sandbox(NULL) {
 }
 
 /**
  * @brief Default destructor.
- * Deletes array of @a char* storing tested program parameters.
+ * If tested program has been launched, but not traced to its end (it is not needed or the run
+ * failed), it is killed. Removes sandbox of the run if it has not been removed yet.
  */
 Tracer::~Tracer() {
-   for (unsigned i = 0; i < programArgsSize; ++i) {
-      delete programArgs[i];
+   if (process > 0) {
+      kill(process, SIGKILL);
+      waitpid(process, NULL, 0);
+      socket->closeClientSocket();
+      // Killed program might have connected already
+      socket->discardConnections();
    }
-   delete programArgs;
+   delete sandbox;
 }
 
 /**
- * @brief Executes tested program and initializes communication with it.
- * Creates new process in which tested program is executed. After succesfull execution realizes
- * initial phase of the communication with tested program (receives INIT message and sends
- * OPTION message as response).
- * @param msg Object containing OPTION message with analysis options sent to tested program.
+ * @brief Launches tested program.
+ * Creates new process in which tested program is executed. Tested program runs until its first
+ * call of a tracked function, where it waits for the analyzer (see ::init). This allows to start
+ * tested program before it is known how its run will be controlled.
+ * If sandbox is used, it is created before the process and tested program is executed in it.
+ * @throws ConfigurationException In case the sandbox can not be created or tested program can not
+ * be executed.
  */
-void Tracer::init(InitialMsg *optionMsg) {
-   pid_t newProcess;
+void Tracer::launch() {
+   std::vector<std::string> sandboxPaths = config->getSandbox();
+   if (!sandboxPaths.empty())
+      sandbox = new Sandbox(sandboxPaths);
+
    // Create new process
-   newProcess = fork();
-   if (newProcess >= 0) {
-      if (newProcess == 0) {
-         socket->closeWelcomeSocket();
-
-         // Redirect stdout and stderr to /dev/null
-         int fd = open("/dev/null", O_WRONLY);
-         dup2(fd, 1);
-         dup2(fd, 2);
-         // Add shared library to LD_PRELOAD
-         char ldPreloadTxt[] = "LD_PRELOAD=bin/lib_filesystem.so";
-         putenv(ldPreloadTxt);
-         // Execute tested program
-         if (execv(programArgs[0], programArgs) == -1)
-            throw ConfigurationException("Program cannot be executed");
-      }
-      else {
-         // Create socket connection to other process
-         socket->acceptConnection();
-
-         // Initialization phase
-         // Receive first message and parse it
-         std::string msgStr = socket->recvMsg();
-         InboundMsg initMsg;
-         initMsg.parse(msgStr);
-         if (initMsg.getType() == INIT) {
-            // If INIT message received, send OPTION message
-            socket->sendMsg(optionMsg->compose());
-         }
-         else {
-            throw ProtocolException("INIT not received.");
-         }
-      }
+   spawn(sandbox != NULL ? sandbox->getRoot() : NULL);
+}
+
+/**
+ * @brief Initializes communication with tested program.
+ * Launches tested program if it has not been launched yet. Then realizes initial phase of
+ * the communication with tested program (receives INIT message and sends OPTION message as
+ * response).
+ * Tested program launched in advance may be used by another analysis with the same ::launchKey,
+ * so the configuration of the run is given again.
+ * @param u Work unit describing how calls of the run are controlled.
+ * @param c Configuration of the analysis the run belongs to.
+ * @param msg Object containing OPTION message with analysis options sent to tested program.
+ * @throws ConfigurationException In case the sandbox can not be created or tested program can not
+ * be executed.
+ */
+void Tracer::init(WorkUnit *u, Configuration *c, InitialMsg *optionMsg) {
+   unit = u;
+   config = c;
+   if (process == 0)
+      launch();
+
+   // Create socket connection to other process
+   socket->acceptConnection();
+
+   // Initialization phase
+   // Receive first message and parse it
+   std::string msgStr = socket->recvMsg();
+   InboundMsg initMsg;
+   initMsg.parse(msgStr);
+   if (initMsg.getType() == INIT) {
+      // If INIT message received, send OPTION message
+      socket->sendMsg(optionMsg->compose());
+   }
+   else {
+      throw ProtocolException("INIT not received.");
    }
 }
 
 /**
  * @brief Traces the running tested program and gets its run.
- * In an infinite loop receives messages from tested program, forwards them to controller and
- * sends back the generated answers. Also receives RETURN messages with information about return
+ * In an infinite loop receives messages from tested program, gets answers to them from the
+ * work unit and sends them back. Also receives RETURN messages with information about return
  * value of the call.
  * The loop is breaked after there are no more messages pending in the socket, or the socket has
  * been closed by tested program.
@@ -118,7 +152,8 @@ Run *Tracer::trace() {
 
    Run *resultRun = new Run();
    std::string msgStr;
-   InboundMsg *inMsg = new InboundMsg();
+   // Calls are added to the run when messages are parsed
+   InboundMsg *inMsg = new InboundMsg(resultRun);
    OutboundMsg *outMsg;
 
    // Loop while tested program is running
@@ -133,13 +168,14 @@ Run *Tracer::trace() {
       if (inMsg->getType() == NOTIFY || inMsg->getType() == CONTROL) {
          // Generate response depending on message type
          if (inMsg->getType() == CONTROL) {
-            outMsg = controller->controlCall(inMsg->getCall(), resultRun, callNum++);
+            // Behavior of the call is given by the work unit
+            outMsg = unit->scheduleCall(inMsg->getCall(), resultRun, callNum++);
          }
          else {
-            outMsg = controller->notifyCall(inMsg->getCall(), callNum++);
+            // Call is only performed (response is always ACK)
+            outMsg = new OutboundMsg(ACK);
+            callNum++;
          }
-         // Push the call to the run
-         resultRun->nextCall(inMsg->getCall());
          try {
             // Send response
             socket->sendMsg(outMsg->compose());
@@ -177,8 +213,79 @@ Run *Tracer::trace() {
    }
    delete inMsg;
    int status;
-   wait(&status);
+   waitpid(process, &status, 0);
+   process = 0;
    socket->closeClientSocket();
+   // Files created by the run are not needed anymore
+   delete sandbox;
+   sandbox = NULL;
    return resultRun;
 }
 
+/**
+ * @brief Gets key identifying tested program launched by ::launch.
+ * Consists of path and arguments of tested program and state of its executable and of files copied
+ * into sandbox. Tested program launched in advance can be used for any configuration with the same
+ * key, other options are sent to it later in OPTION message.
+ * @param c Configuration of the analysis.
+ * @return Key of launched tested program.
+ */
+std::string Tracer::launchKey(Configuration *c) {
+   std::ostringstream key;
+   for (char *const *arg = c->getProgramArgs(); *arg != NULL; ++arg)
+      key << *arg << '\0';
+   key << "\n";
+   // Executable is described like sandbox files, so its rebuild is detected
+   Sandbox::describe(c->getProgramPath(), key);
+   for (auto &path : c->getSandbox())
+      Sandbox::describe(path, key);
+   return key.str();
+}
+
+
+/**
+ * @brief Starts process of tested program.
+ * Standard output and error output of tested program are redirected to /dev/null and it does not
+ * inherit any other descriptors of the analyzer (e.g. output file), so its descriptors do not
+ * depend on the process and worker which started it.
+ * If possible, posix_spawn() is used, so the cost of creating the process does not grow with
+ * memory of the analyzer, otherwise the process is forked.
+ * @param root Directory in which tested program is executed (NULL for working directory).
+ * @throws ConfigurationException In case tested program can not be executed.
+ */
+void Tracer::spawn(const char *root) {
+#ifdef TRACER_SPAWN
+   posix_spawn_file_actions_t actions;
+   posix_spawn_file_actions_init(&actions);
+   posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+   posix_spawn_file_actions_adddup2(&actions, 1, 2);
+   posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+   if (root != NULL)
+      posix_spawn_file_actions_addchdir_np(&actions, root);
+   int res = posix_spawn(&process, config->getProgramPath(), &actions, NULL,
+         config->getProgramArgs(), programEnv);
+   posix_spawn_file_actions_destroy(&actions);
+   if (res != 0)
+      throw ConfigurationException("Tested program can not be executed");
+#else
+   // Everything used by the child is prepared before fork, because it must not allocate memory
+   const char *path = config->getProgramPath();
+   char *const *args = config->getProgramArgs();
+   process = fork();
+   if (process < 0)
+      throw ConfigurationException("Tested program can not be executed");
+   if (process == 0) {
+      // Redirect stdout and stderr to /dev/null
+      int fd = open("/dev/null", O_WRONLY);
+      dup2(fd, 1);
+      dup2(fd, 2);
+      closeDescriptors();
+      if (root != NULL && chdir(root) != 0)
+         _exit(127);
+      // Execute tested program with shared library preloaded
+      execve(path, args, programEnv);
+      // Program cannot be executed, analyzer will not get connection from it
+      _exit(127);
+   }
+#endif
+}
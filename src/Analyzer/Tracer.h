@@ -17,11 +17,13 @@
 #define TRACER_H_
 
 #include "Socket.h"
-#include "Controller.h"
 #include "Parser/InitialMsg.h"
 #include "Configuration.h"
 #include "Run.h"
+#include "Scheduler/WorkUnit.h"
+#include "Sandbox.h"
 
+#include <sys/types.h>
 #include <vector>
 #include <string>
 
@@ -32,51 +34,91 @@
  * Also sends generated answers back.
  * From these calls, it creates the run of the program.
  * Each object of this class is used to create one single run - sequence of calls from beginning
- * of tested program to its end.
+ * of tested program to its end. The way the calls are controlled is given by a work unit.
  */
 class Tracer {
 public:
    /**
     * @brief Constructor with members initialization.
-    * Initializes pointers to socket and controller. Also converts given vector of string with
-    * tested program name and parameters into array of @a char*.
+    * Initializes pointers to socket and configuration. Arguments of tested program are taken from
+    * the configuration and its environment is given by the worker, so both are created only once
+    * and not for each run.
     * @param s Pointer to the Socket object used for communication.
-    * @param c Pointer to the Controller object which created this Tracer.
-    * @param prog Vector of strings with tested program destination and parameters.
+    * @param c Configuration of the analysis (contains tested program and its arguments).
+    * @param env Environment of tested program (NULL-terminated array).
     */
-   Tracer(Socket *s, Controller *c, std::vector<std::string> prog);
+   Tracer(Socket *s, Configuration *c, char *const *env);
    /**
     * @brief Default destructor.
-    * Deletes array of @a char* storing tested program parameters.
+    * If tested program has been launched, but not traced to its end (it is not needed or the run
+    * failed), it is killed. Removes sandbox of the run if it has not been removed yet.
     */
    virtual ~Tracer();
 
    /**
-    * @brief Executes tested program and initializes communication with it.
-    * Creates new process in which tested program is executed. After succesfull execution realizes
-    * initial phase of the communication with tested program (receives INIT message and sends
-    * OPTION message as response).
+    * @brief Launches tested program.
+    * Creates new process in which tested program is executed. Tested program runs until its first
+    * call of a tracked function, where it waits for the analyzer (see ::init). This allows to
+    * start tested program before it is known how its run will be controlled.
+    * If sandbox is used, it is created before the process and tested program is executed in it.
+    * @throws ConfigurationException In case the sandbox can not be created or tested program can
+    * not be executed.
+    */
+   void launch();
+   /**
+    * @brief Initializes communication with tested program.
+    * Launches tested program if it has not been launched yet. Then realizes initial phase of
+    * the communication with tested program (receives INIT message and sends OPTION message as
+    * response).
+    * Tested program launched in advance may be used by another analysis with the same
+    * ::launchKey, so the configuration of the run is given again.
+    * @param u Work unit describing how calls of the run are controlled.
+    * @param c Configuration of the analysis the run belongs to.
     * @param msg Object containing OPTION message with analysis options sent to tested program.
+    * @throws ConfigurationException In case the sandbox can not be created or tested program can
+    * not be executed.
     */
-   void init(InitialMsg *msg);
+   void init(WorkUnit *u, Configuration *c, InitialMsg *msg);
    /**
     * @brief Traces the running tested program and gets its run.
-    * In an infinite loop receives messages from tested program, forwards them to controller and
-    * sends back the generated answers. Also receives RETURN messages with information about return
+    * In an infinite loop receives messages from tested program, gets answers to them from the
+    * work unit and sends them back. Also receives RETURN messages with information about return
     * value of the call.
     * The loop is breaked after there are no more messages pending in the socket, or the socket has
     * been closed by tested program.
     * @return Run of the tested program.
     */
    Run *trace();
+
+   /**
+    * @brief Gets key identifying tested program launched by ::launch.
+    * Consists of path and arguments of tested program and state of its executable and of files
+    * copied into sandbox. Tested program launched in advance can be used for any configuration
+    * with the same key, other options are sent to it later in OPTION message.
+    * @param c Configuration of the analysis.
+    * @return Key of launched tested program.
+    */
+   static std::string launchKey(Configuration *c);
 protected:
    int callNum; /**< Current call number in the run */
    Socket *socket; /**< Pointer to the Socket object used for communication with tested program. */
-   Controller *controller; /**< Pointer to the Controller where parsed messages are being sent
-                            * in order to get answers to those messages. */
-   char **programArgs; /**< Array of c-strings with tested program destination as the first item
-                        * and its parameters as the rest of items. */
-   unsigned programArgsSize; /**< Size of ::programArgs array */
+   Configuration *config; /**< Configuration of the analysis */
+   WorkUnit *unit; /**< Work unit describing how calls of the run are controlled */
+   pid_t process; /**< Process ID of tested program (0 if it is not running) */
+   char *const *programEnv; /**< Environment of tested program */
+   Sandbox *sandbox; /**< Sandbox of the current run (NULL if it is not used) */
+private:
+   /**
+    * @brief Starts process of tested program.
+    * Standard output and error output of tested program are redirected to /dev/null and it does
+    * not inherit any other descriptors of the analyzer (e.g. output file), so its descriptors do
+    * not depend on the process and worker which started it.
+    * If possible, posix_spawn() is used, so the cost of creating the process does not grow with
+    * memory of the analyzer, otherwise the process is forked.
+    * @param root Directory in which tested program is executed (NULL for working directory).
+    * @throws ConfigurationException In case tested program can not be executed.
+    */
+   void spawn(const char *root);
 };
 
 #endif /* TRACER_H_ */
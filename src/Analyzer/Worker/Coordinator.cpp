@@ -0,0 +1,63 @@
+/**
+ * @file Coordinator.cpp
+ *
+ * Contains implementation of methods of the class Coordinator.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Worker/Coordinator.h"
+#include "Exceptions/SocketException.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <errno.h>
+#include <iostream>
+
+/**
+ * @brief Constructor starting listening on given address.
+ * @param a Path of Unix socket or tcp:HOST:PORT of TCP socket.
+ * @throws SocketException In case the socket can not be created.
+ */
+Coordinator::Coordinator(std::string a) :
+      address(a), listenSocket(Connection::openSocket(a, true)) {
+}
+
+/**
+ * @brief Default destructor.
+ * Stops listening (already accepted connections are not affected).
+ */
+Coordinator::~Coordinator() {
+   close(listenSocket);
+   if (!Connection::isTcp(address))
+      unlink(address.c_str());
+}
+
+/**
+ * @brief Waits for a worker process to connect.
+ * @return Connection with the worker process.
+ * @throws SocketException In case accepting fails.
+ */
+Connection *Coordinator::acceptWorker() {
+   int fd;
+   while ((fd = accept4(listenSocket, NULL, NULL, SOCK_CLOEXEC)) < 0
+         || !Connection::isTrusted(fd)) {
+      if (fd >= 0) {
+         std::cerr << "Connection of other user refused" << std::endl;
+         close(fd);
+      }
+      else if (errno != EINTR)
+         throw SocketException("Accepting worker failed");
+   }
+   // Units and runs are small messages sent in turns (fails for Unix sockets, which is harmless)
+   int on = 1;
+   setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+   return new Connection(fd);
+}
@@ -0,0 +1,54 @@
+/**
+ * @file Coordinator.h
+ *
+ * @brief Coordinator class.
+ *
+ * Contains definition of the class Coordinator, which accepts connections of worker processes.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef COORDINATOR_H_
+#define COORDINATOR_H_
+
+#include "Connection.h"
+
+#include <string>
+
+/**
+ * @brief Listening side of the coordinator.
+ *
+ * Listens on the address given by configuration option @a coordinator and accepts worker
+ * processes started by "analyzer --worker ADDRESS". Accepted workers are wrapped into
+ * RemoteWorker objects.
+ */
+class Coordinator {
+public:
+   /**
+    * @brief Constructor starting listening on given address.
+    * @param a Path of Unix socket or tcp:HOST:PORT of TCP socket.
+    * @throws SocketException In case the socket can not be created.
+    */
+   Coordinator(std::string a);
+   /**
+    * @brief Default destructor.
+    * Stops listening (already accepted connections are not affected).
+    */
+   virtual ~Coordinator();
+
+   /**
+    * @brief Waits for a worker process to connect.
+    * @return Connection with the worker process.
+    * @throws SocketException In case accepting fails.
+    */
+   Connection *acceptWorker();
+protected:
+   std::string address; /**< Address where the coordinator listens */
+   int listenSocket; /**< Socket accepting connections of workers */
+};
+
+#endif /* COORDINATOR_H_ */
@@ -0,0 +1,106 @@
+/**
+ * @file LocalWorker.cpp
+ *
+ * Contains implementation of methods of the class LocalWorker.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Worker/LocalWorker.h"
+#include "Tracer.h"
+#include "Exceptions/ConfigurationException.h"
+
+#include <unistd.h>
+#include <cstdlib>
+
+/**
+ * @brief Constructor creating socket of the worker.
+ * Also creates environment of tested program: shared library is added to LD_PRELOAD and
+ * the library is told which socket to connect to. The environment is the same for all runs
+ * executed by the worker.
+ * @param path File destination of the named socket of the worker.
+ * @throws SocketException In case the socket cannot be created.
+ */
+LocalWorker::LocalWorker(std::string path) :
+      socket(new Socket(path)), launched(NULL) {
+   for (char **var = environ; *var != NULL; ++var) {
+      std::string varStr(*var);
+      if (varStr.compare(0, 11, "LD_PRELOAD=") != 0 && varStr.compare(0, 16, "ANALYZER_SOCKET=") != 0)
+         programEnv.push_back(varStr);
+   }
+   // Library is given by absolute path, tested program may be executed in a sandbox
+   std::string cwd;
+   char *cwdStr = getcwd(NULL, 0);
+   if (cwdStr != NULL) {
+      cwd = std::string(cwdStr) + "/";
+      free(cwdStr);
+   }
+   programEnv.push_back("LD_PRELOAD=" + cwd + "bin/lib_filesystem.so");
+   programEnv.push_back("ANALYZER_SOCKET=" + socket->getPath());
+   for (auto &var : programEnv) {
+      programEnvp.push_back(&var[0]);
+   }
+   programEnvp.push_back(NULL);
+}
+
+/**
+ * @brief Default destructor.
+ * Kills tested program launched in advance, closes and removes the socket.
+ */
+LocalWorker::~LocalWorker() {
+   delete launched;
+   socket->closeWelcomeSocket();
+   delete socket;
+}
+
+/**
+ * @brief Executes unit.
+ * Uses Tracer object, which runs tested program and traces it from beginning to the end.
+ * The initial unit is traced with initial message of the first run.
+ * Tested program launched after the previous run is used if it has the same Tracer::launchKey
+ * (even if it was launched for another analysis), otherwise it is killed and new one is launched.
+ * If the configuration allows it, next tested program is launched after the run ends.
+ * @param unit Unit to be executed.
+ * @param config Configuration of the analysis the unit belongs to.
+ * @return Run of tested program.
+ */
+Run *LocalWorker::execute(WorkUnit *unit, Configuration *config) {
+   std::string key = Tracer::launchKey(config);
+   Tracer *tracer = launched;
+   launched = NULL;
+   if (tracer != NULL && launchedKey != key) {
+      delete tracer;
+      tracer = NULL;
+   }
+   if (tracer == NULL)
+      tracer = new Tracer(socket, config, &programEnvp[0]);
+
+   Run *run;
+   try {
+      InitialMsg *msg = unit->isInitial() ? config->getFirstInitMsg() : config->getInitMsg();
+      tracer->init(unit, config, msg);
+      run = tracer->trace();
+   } catch (...) {
+      delete tracer;
+      throw;
+   }
+   delete tracer;
+
+   if (config->checkPrelaunch()) {
+      // Start of next tested program overlaps with processing of this run
+      launched = new Tracer(socket, config, &programEnvp[0]);
+      try {
+         launched->launch();
+         launchedKey = key;
+      } catch (ConfigurationException &e) {
+         // Error will be reported when the program is launched again for the next run
+         delete launched;
+         launched = NULL;
+      }
+   }
+   return run;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file LocalWorker.h
+ *
+ * @brief LocalWorker class.
+ *
+ * Contains definition of the class LocalWorker, which executes work units by tracing tested
+ * program.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef LOCALWORKER_H_
+#define LOCALWORKER_H_
+
+#include "Worker/Worker.h"
+#include "Socket.h"
+#include "Tracer.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Worker tracing tested program.
+ *
+ * Executes units by running tested program on the local machine. Each worker has its own socket,
+ * so several workers can trace tested program at the same time.
+ */
+class LocalWorker: public Worker {
+public:
+   /**
+    * @brief Constructor creating socket of the worker.
+    * Also creates environment of tested program: shared library is added to LD_PRELOAD and
+    * the library is told which socket to connect to. The environment is the same for all runs
+    * executed by the worker.
+    * @param path File destination of the named socket of the worker.
+    * @throws SocketException In case the socket cannot be created.
+    */
+   LocalWorker(std::string path);
+   /**
+    * @brief Default destructor.
+    * Kills tested program launched in advance, closes and removes the socket.
+    */
+   virtual ~LocalWorker();
+
+   /**
+    * @brief Executes unit.
+    * Uses Tracer object, which runs tested program and traces it from beginning to the end.
+    * The initial unit is traced with initial message of the first run.
+    * Tested program launched after the previous run is used if it has the same
+    * Tracer::launchKey (even if it was launched for another analysis), otherwise it is killed and
+    * new one is launched. If the configuration allows it, next tested program is launched after
+    * the run ends.
+    * @param unit Unit to be executed.
+    * @param config Configuration of the analysis the unit belongs to.
+    * @return Run of tested program.
+    */
+   virtual Run *execute(WorkUnit *unit, Configuration *config);
+protected:
+   Socket *socket; /**< Socket used for communication with tested program */
+   std::vector<std::string> programEnv; /**< Environment variables of tested program */
+   std::vector<char *> programEnvp; /**< Array of c-strings pointing to ::programEnv, terminated
+                                     * by NULL */
+   Tracer *launched; /**< Tracer of tested program launched in advance (NULL if there is none) */
+   std::string launchedKey; /**< Tracer::launchKey of ::launched */
+};
+
+#endif /* LOCALWORKER_H_ */
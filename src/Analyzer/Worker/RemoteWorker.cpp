@@ -0,0 +1,83 @@
+/**
+ * @file RemoteWorker.cpp
+ *
+ * Contains implementation of methods of the class RemoteWorker.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Worker/RemoteWorker.h"
+#include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
+#include "Exceptions/SocketException.h"
+#include "Exceptions/SocketClosedException.h"
+
+/**
+ * @brief Constructor with connection initialization.
+ * @param c Connection with the worker process (deleted by this object).
+ */
+RemoteWorker::RemoteWorker(Connection *c) :
+      connection(c) {
+}
+
+/**
+ * @brief Default destructor.
+ * Closes the connection, which makes the worker process end.
+ */
+RemoteWorker::~RemoteWorker() {
+   delete connection;
+}
+
+/**
+ * @brief Executes unit.
+ * Sends unit to the worker process and waits for the run.
+ * @param unit Unit to be executed.
+ * @param config Configuration of the analysis the unit belongs to.
+ * @return Run of tested program.
+ * @throws ConfigurationException, ProtocolException, SocketException In case the execution
+ * failed in the worker process (same exception as the one thrown in the worker).
+ * @throws SocketException In case the connection with the worker process is lost.
+ */
+Run *RemoteWorker::execute(WorkUnit *unit, Configuration *config) {
+   std::string reply;
+   try {
+      // Requests are "CONFIG" or "UNIT" followed by newline and data
+      if (config->getText() != configText) {
+         connection->sendMsg("CONFIG\n" + config->getText());
+         configText = config->getText();
+      }
+      connection->sendMsg("UNIT\n" + unit->compose());
+      reply = connection->recvMsg();
+   } catch (SocketClosedException &e) {
+      throw SocketException("Worker disconnected");
+   }
+
+   // Reply is either "RUN" or "ERROR <exception type>" followed by newline and data
+   size_t lineEnd = reply.find('\n');
+   if (lineEnd == std::string::npos)
+      throw ProtocolException("Invalid reply from worker");
+   std::string type = reply.substr(0, lineEnd);
+   std::string data = reply.substr(lineEnd + 1);
+   if (type == "RUN") {
+      Run *run = new Run();
+      try {
+         run->parse(data);
+      } catch (ProtocolException &e) {
+         delete run;
+         throw;
+      }
+      return run;
+   }
+   else if (type == "ERROR CONFIGURATION")
+      throw ConfigurationException(data);
+   else if (type == "ERROR PROTOCOL")
+      throw ProtocolException(data);
+   else if (type == "ERROR SOCKET")
+      throw SocketException(data);
+   else
+      throw ProtocolException("Invalid reply from worker");
+}
@@ -0,0 +1,62 @@
+/**
+ * @file RemoteWorker.h
+ *
+ * @brief RemoteWorker class.
+ *
+ * Contains definition of the class RemoteWorker, which executes work units in a worker process
+ * connected to the coordinator.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef REMOTEWORKER_H_
+#define REMOTEWORKER_H_
+
+#include "Worker/Worker.h"
+#include "Connection.h"
+
+#include <string>
+
+/**
+ * @brief Worker delegating units to another analyzer process.
+ *
+ * Coordinator side of the connection with a worker process (see WorkerProcess). Worker process
+ * receives configuration of the analysis (only when it differs from the previous one) and units,
+ * and sends back runs obtained by executing them.
+ * Runs are merged into the graph by the coordinator, so the result of the analysis is the same
+ * as if all units were executed locally.
+ */
+class RemoteWorker: public Worker {
+public:
+   /**
+    * @brief Constructor with connection initialization.
+    * @param c Connection with the worker process (deleted by this object).
+    */
+   RemoteWorker(Connection *c);
+   /**
+    * @brief Default destructor.
+    * Closes the connection, which makes the worker process end.
+    */
+   virtual ~RemoteWorker();
+
+   /**
+    * @brief Executes unit.
+    * Sends unit to the worker process and waits for the run.
+    * @param unit Unit to be executed.
+    * @param config Configuration of the analysis the unit belongs to.
+    * @return Run of tested program.
+    * @throws ConfigurationException, ProtocolException, SocketException In case the execution
+    * failed in the worker process (same exception as the one thrown in the worker).
+    * @throws SocketException In case the connection with the worker process is lost.
+    */
+   virtual Run *execute(WorkUnit *unit, Configuration *config);
+protected:
+   Connection *connection; /**< Connection with the worker process */
+   std::string configText; /**< Text of the configuration last sent to the worker process */
+};
+
+#endif /* REMOTEWORKER_H_ */
@@ -0,0 +1,48 @@
+/**
+ * @file Worker.h
+ *
+ * @brief Worker class.
+ *
+ * Contains definition of the abstract class Worker, which executes work units.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef WORKER_H_
+#define WORKER_H_
+
+#include "Run.h"
+#include "Configuration.h"
+#include "Scheduler/WorkUnit.h"
+
+/**
+ * @brief Executor of work units.
+ *
+ * Abstract class for executing units planned by scheduler. Worker executes one unit at a time,
+ * parallelism is achieved by using more workers (see WorkerPool).
+ * Units may be executed by tracing tested program directly (LocalWorker), or by another analyzer
+ * process (RemoteWorker).
+ */
+class Worker {
+public:
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~Worker() {
+   }
+
+   /**
+    * @brief Executes unit.
+    * @param unit Unit to be executed.
+    * @param config Configuration of the analysis the unit belongs to (workers may be shared by
+    * several analyses).
+    * @return Run of tested program obtained by executing the unit.
+    */
+   virtual Run *execute(WorkUnit *unit, Configuration *config) = 0;
+};
+
+#endif /* WORKER_H_ */
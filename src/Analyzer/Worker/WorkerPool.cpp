@@ -0,0 +1,114 @@
+/**
+ * @file WorkerPool.cpp
+ *
+ * Contains implementation of methods of the class WorkerPool.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Worker/WorkerPool.h"
+#include "Controller.h"
+
+#include <algorithm>
+
+/**
+ * @brief Constructor starting worker threads.
+ * @param w Workers of the pool (deleted by the pool).
+ */
+WorkerPool::WorkerPool(std::vector<Worker *> w) :
+      workers(w), stopping(false) {
+   for (unsigned i = 0; i < workers.size(); ++i) {
+      threads.push_back(std::thread(&WorkerPool::run, this, i));
+   }
+}
+
+/**
+ * @brief Default destructor.
+ * Waits until workers finish units being executed and stops them. Units that have not been
+ * started yet are not executed.
+ */
+WorkerPool::~WorkerPool() {
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+   }
+   jobAdded.notify_all();
+   for (auto &thread : threads) {
+      thread.join();
+   }
+   for (auto worker : workers) {
+      delete worker;
+   }
+}
+
+/**
+ * @brief Submits unit for execution.
+ * @param c Controller executing the unit.
+ * @param unit Unit to be executed.
+ */
+void WorkerPool::execute(Controller *c, WorkUnit *unit) {
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      jobs.push_back(Job { c, unit });
+   }
+   jobAdded.notify_one();
+}
+
+/**
+ * @brief Waits until unit is executed.
+ * If an exception has been thrown during execution, it is thrown again.
+ * @param unit Unit that has been submitted to the pool.
+ */
+void WorkerPool::wait(WorkUnit *unit) {
+   std::unique_lock<std::mutex> lock(mutex);
+   std::vector<WorkUnit *>::iterator it;
+   jobFinished.wait(lock, [&] {
+      return (it = std::find(finished.begin(), finished.end(), unit)) != finished.end();
+   });
+   finished.erase(it);
+   lock.unlock();
+   if (unit->getError())
+      std::rethrow_exception(unit->getError());
+}
+
+/**
+ * @brief Gets number of workers.
+ * @return Number of workers in the pool.
+ */
+unsigned WorkerPool::getSize() {
+   return threads.size();
+}
+
+/**
+ * @brief Main function of a worker thread.
+ * Takes units from ::jobs and executes them until ::stopping is set.
+ * @param index Index of the worker.
+ */
+void WorkerPool::run(unsigned index) {
+   while (true) {
+      Job job;
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         jobAdded.wait(lock, [this] {return stopping || !jobs.empty();});
+         if (stopping)
+            break;
+         job = jobs.front();
+         jobs.pop_front();
+      }
+      // Execute the unit, exceptions are passed to the thread waiting for the unit
+      try {
+         job.controller->executeUnit(workers[index], job.unit);
+      } catch (...) {
+         job.unit->setError(std::current_exception());
+      }
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         finished.push_back(job.unit);
+      }
+      jobFinished.notify_all();
+   }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file WorkerPool.h
+ *
+ * @brief WorkerPool class.
+ *
+ * Contains definition of the class WorkerPool, which executes runs of tested program in parallel
+ * worker threads.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include "Worker/Worker.h"
+#include "Scheduler/WorkUnit.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Forward declaration of class Controller (for linker)
+class Controller;
+
+/**
+ * @brief Pool of workers executing runs of tested program.
+ *
+ * Each worker has its own thread, so several instances of tested program can be traced at the
+ * same time (locally or by worker processes). Units are executed in the order they were
+ * submitted, but they can finish in any order. Execution of a unit itself is done by
+ * Controller::executeUnit, the pool only distributes units among workers.
+ */
+class WorkerPool {
+public:
+   /**
+    * @brief Constructor starting worker threads.
+    * @param w Workers of the pool (deleted by the pool).
+    */
+   WorkerPool(std::vector<Worker *> w);
+   /**
+    * @brief Default destructor.
+    * Waits until workers finish units being executed and stops them. Units that have not been
+    * started yet are not executed.
+    */
+   virtual ~WorkerPool();
+
+   /**
+    * @brief Submits unit for execution.
+    * @param c Controller executing the unit.
+    * @param unit Unit to be executed.
+    */
+   void execute(Controller *c, WorkUnit *unit);
+   /**
+    * @brief Waits until unit is executed.
+    * If an exception has been thrown during execution, it is thrown again.
+    * @param unit Unit that has been submitted to the pool.
+    */
+   void wait(WorkUnit *unit);
+   /**
+    * @brief Gets number of workers.
+    * @return Number of workers in the pool.
+    */
+   unsigned getSize();
+protected:
+   /**
+    * @brief Unit waiting for execution.
+    */
+   struct Job {
+      Controller *controller; /**< Controller executing the unit */
+      WorkUnit *unit; /**< Unit to be executed */
+   };
+
+   std::vector<Worker *> workers; /**< Workers executing units */
+   std::vector<std::thread> threads; /**< Threads of workers */
+   std::deque<Job> jobs; /**< Units waiting for execution */
+   std::vector<WorkUnit *> finished; /**< Units that have been executed but not waited for */
+   std::mutex mutex; /**< Mutex guarding ::jobs, ::finished and ::stopping */
+   std::condition_variable jobAdded; /**< Condition signalled when new unit is submitted */
+   std::condition_variable jobFinished; /**< Condition signalled when a unit is executed */
+   bool stopping; /**< Flag set when workers shall end */
+private:
+   /**
+    * @brief Main function of a worker thread.
+    * Takes units from ::jobs and executes them until ::stopping is set.
+    * @param index Index of the worker.
+    */
+   void run(unsigned index);
+};
+
+#endif /* WORKERPOOL_H_ */
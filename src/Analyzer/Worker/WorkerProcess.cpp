@@ -0,0 +1,112 @@
+/**
+ * @file WorkerProcess.cpp
+ *
+ * Contains implementation of methods of the class WorkerProcess.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Worker/WorkerProcess.h"
+#include "Worker/LocalWorker.h"
+#include "Connection.h"
+#include "Exceptions/ConfigurationException.h"
+#include "Exceptions/ProtocolException.h"
+#include "Exceptions/SocketException.h"
+#include "Exceptions/SocketClosedException.h"
+
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+
+/**
+ * Number of attempts to connect to the coordinator.
+ */
+static const unsigned CONNECT_ATTEMPTS = 50;
+
+/**
+ * @brief Constructor with configuration initialization.
+ * @param c Configuration containing the coordinator address.
+ */
+WorkerProcess::WorkerProcess(Configuration *c) :
+      configuration(c) {
+}
+
+/**
+ * @brief Default destructor.
+ */
+WorkerProcess::~WorkerProcess() {
+}
+
+/**
+ * @brief Executes units sent by the coordinator.
+ * Connection to the coordinator is retried for a while, so the worker can be started before
+ * the coordinator.
+ * @throws SocketException In case the coordinator is not available.
+ */
+void WorkerProcess::start() {
+   Connection *connection = NULL;
+   for (unsigned attempt = 1; connection == NULL; ++attempt) {
+      try {
+         connection = new Connection(configuration->getWorkerAddress());
+      } catch (SocketException &e) {
+         if (attempt == CONNECT_ATTEMPTS)
+            throw;
+         std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+   }
+
+   Configuration *jobConfig = NULL;
+   try {
+      LocalWorker worker("/tmp/analyserSocket." + std::to_string(getpid()));
+      std::cerr << "Worker connected to " << configuration->getWorkerAddress() << std::endl;
+
+      // Execute units until coordinator closes connection
+      while (true) {
+         std::string request = connection->recvMsg();
+         size_t lineEnd = request.find('\n');
+         std::string type = request.substr(0, lineEnd);
+         std::string data = lineEnd != std::string::npos ? request.substr(lineEnd + 1) : "";
+         if (type == "CONFIG") {
+            // Configuration of next units
+            delete jobConfig;
+            jobConfig = new Configuration();
+            jobConfig->parseText(data);
+            continue;
+         }
+         if (type != "UNIT" || jobConfig == NULL)
+            throw ProtocolException("Invalid request from coordinator");
+         WorkUnit unit;
+         unit.parse(data);
+         std::string reply;
+         // Errors of execution are passed to the coordinator
+         try {
+            Run *run = worker.execute(&unit, jobConfig);
+            reply = "RUN\n" + run->compose();
+            delete run;
+         } catch (ConfigurationException &e) {
+            reply = "ERROR CONFIGURATION\n" + e.getDescription();
+         } catch (ProtocolException &e) {
+            reply = "ERROR PROTOCOL\n" + e.getDescription();
+         } catch (SocketException &e) {
+            reply = "ERROR SOCKET\n" + e.getDescription();
+         } catch (SocketClosedException &e) {
+            reply = "ERROR SOCKET\nTested program closed connection";
+         }
+         connection->sendMsg(reply);
+      }
+   } catch (SocketClosedException &e) {
+      // Coordinator finished the analysis
+      std::cerr << "Coordinator closed connection" << std::endl;
+   } catch (...) {
+      delete jobConfig;
+      delete connection;
+      throw;
+   }
+   delete jobConfig;
+   delete connection;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file WorkerProcess.h
+ *
+ * @brief WorkerProcess class.
+ *
+ * Contains definition of the class WorkerProcess, which executes work units received from
+ * the coordinator.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef WORKERPROCESS_H_
+#define WORKERPROCESS_H_
+
+#include "Configuration.h"
+
+/**
+ * @brief Analyzer working for a coordinator.
+ *
+ * Used when the analyzer is started as "analyzer --worker ADDRESS". Connects to the coordinator
+ * and executes units sent by the coordinator until the coordinator closes the connection. Units
+ * are executed with the configuration last sent by the coordinator. Run obtained from each unit
+ * is sent back to the coordinator, which merges it into the graph (see RemoteWorker).
+ */
+class WorkerProcess {
+public:
+   /**
+    * @brief Constructor with configuration initialization.
+    * @param c Configuration containing the coordinator address.
+    */
+   WorkerProcess(Configuration *c);
+   /**
+    * @brief Default destructor.
+    */
+   virtual ~WorkerProcess();
+
+   /**
+    * @brief Executes units sent by the coordinator.
+    * Connection to the coordinator is retried for a while, so the worker can be started before
+    * the coordinator.
+    * @throws SocketException In case the coordinator is not available.
+    */
+   void start();
+protected:
+   Configuration *configuration; /**< Configuration with the coordinator address */
+};
+
+#endif /* WORKERPROCESS_H_ */
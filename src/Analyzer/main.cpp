@@ -7,12 +7,16 @@
 
 #include <string>
 #include <iostream>
+#include <exception>
 
 #include "Controller.h"
 #include "Exceptions/ProtocolException.h"
 #include "Exceptions/SocketException.h"
 #include "Exceptions/ConfigurationException.h"
 #include "Configuration.h"
+#include "Worker/WorkerProcess.h"
+#include "Daemon.h"
+#include "Batch.h"
 
 int main(int argc, char *argv[]) {
    try {
@@ -20,6 +24,21 @@ int main(int argc, char *argv[]) {
       config.parse(argc, argv);
       if (config.checkHelp())
          config.printHelp();
+      else if (!config.getWorkerAddress().empty()) {
+         WorkerProcess worker(&config);
+         worker.start();
+      }
+      else if (!config.getDaemonAddress().empty()) {
+         Daemon daemon(config.getDaemonAddress(), config.getWorkers());
+         daemon.start();
+      }
+      else if (!config.getSubmitAddress().empty())
+         std::cerr << Daemon::submit(config.getSubmitAddress(), config.getText());
+      else if (!config.getBatchManifest().empty()) {
+         Batch batch(config.getBatchManifest(), config.getWorkers());
+         batch.start();
+         batch.printSummary();
+      }
       else {
          Controller controller(&config);
          controller.startAnalysis();
@@ -31,6 +50,8 @@ int main(int argc, char *argv[]) {
       std::cerr << "Communication protocol error" << std::endl << e.getDescription() << std::endl;
    } catch (ConfigurationException &e) {
       std::cerr << "Configuration error:" << std::endl << e.getDescription() << std::endl;
+   } catch (std::exception &e) {
+      std::cerr << "Error:" << std::endl << e.what() << std::endl;
    }
 
    return 0;
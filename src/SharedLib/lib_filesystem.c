@@ -34,9 +34,15 @@
 #include <sys/mount.h>
 #include <stdarg.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 
 #define SOCKET_PATH "/tmp/analyserSocket"
 #define FUNCTIONS_CNT 45
+// Size of a numeric parameter in typed encoding (including terminating null byte), strings are
+// stored in larger buffers if needed (see stringParam)
+#define PARAM_SIZE 100
+// Maximal size of a return value in typed encoding (including terminating null byte)
+#define RETURN_SIZE 24
 
 /**
  * Enumeration type representing all supported functions.
@@ -223,6 +229,44 @@ TInMsg *parseInMsg(char *msg) {
       return NULL;
 }
 
+/**
+ * @brief Sends message to the analyzer.
+ * The message is prefixed by its length and newline, so it may have any length. errno is not
+ * changed, because it may already contain error of the wrapped call.
+ * @param msg Message to be sent.
+ */
+void sendMsg(const char *msg) {
+   int savedErrno = errno;
+   size_t length = strlen(msg);
+   char header[24];
+   struct iovec parts[2];
+   parts[0].iov_base = header;
+   parts[0].iov_len = snprintf(header, sizeof(header), "%zu\n", length);
+   parts[1].iov_base = (void *) msg;
+   parts[1].iov_len = length;
+   struct iovec *part = parts;
+   int partsCnt = 2;
+   while (partsCnt > 0) {
+      ssize_t res = writev(socketFd, part, partsCnt);
+      if (res < 0) {
+         if (errno == EINTR)
+            continue;
+         break;
+      }
+      // Skip the data that have been sent
+      while (partsCnt > 0 && (size_t) res >= part->iov_len) {
+         res -= part->iov_len;
+         ++part;
+         --partsCnt;
+      }
+      if (partsCnt > 0) {
+         part->iov_base = (char *) part->iov_base + res;
+         part->iov_len -= res;
+      }
+   }
+   errno = savedErrno;
+}
+
 /**
  * @brief Create socket connection with controller.
  * Connection is created only if global variable socketFd contains 0 (no connectino has been 
@@ -237,16 +281,20 @@ void socketConnection() {
          fprintf(stderr, "Socket error\n");
       }
       // Create structure with server socket destination
+      // (analyzer running more workers passes socket of the worker in environment)
+      const char *path = getenv("ANALYZER_SOCKET");
+      if (path == NULL || strlen(path) >= sizeof(((struct sockaddr_un *) 0)->sun_path))
+         path = SOCKET_PATH;
       struct sockaddr_un saddr;
       saddr.sun_family = AF_UNIX;
-      strcpy(saddr.sun_path, SOCKET_PATH);
+      strcpy(saddr.sun_path, path);
       // Connect to server socket
       if ((connect(socketFd, (struct sockaddr*) &saddr, sizeof(saddr))) == -1) {
          fprintf(stderr, "Connect error\n");
       }
 
       // Send INIT message
-      send(socketFd, "INIT\r\n\r\n", 8, 0);
+      sendMsg("INIT\r\n\r\n");
 
       // Receive and parse option message
       char buf[250];
@@ -257,34 +305,67 @@ void socketConnection() {
    }
 }
 
+/**
+ * @brief Writes string parameter in typed encoding.
+ * Buffer of the parameter is enlarged if the string does not fit into it, so paths are never
+ * shortened.
+ * @param param Buffer of the parameter (PARAM_SIZE bytes allocated by malloc).
+ * @param str Value of the parameter (NULL is written as "(null)", same as by printf).
+ */
+void stringParam(char **param, const char *str) {
+   if (str == NULL)
+      str = "(null)";
+   size_t size = strlen(str) + 2;
+   if (size > PARAM_SIZE) {
+      char *larger = realloc(*param, size);
+      if (larger == NULL) {
+         fprintf(stderr, "Malloc error\n");
+         (*param)[0] = '\0';
+         return;
+      }
+      *param = larger;
+   }
+   (*param)[0] = 's';
+   memcpy(*param + 1, str, size - 1);
+}
+
 /**
  * @brief Compose outbound message.
  * Message is of type NOTIFY or CONTROL depending on settings from OPTION message.
+ * Each parameter is sent on its own line in typed encoding: the first character is type of
+ * the value followed by the value printed as by printf:
+ *    d - signed integer (%d), u - unsigned integer (%u), p - pointer (%p),
+ *    o - mode or permissions (%lo), s - path or other string (%s).
+ * The message is allocated with the size it needs, parameters are never shortened.
  * @param  function  Function which the message informs about.
  * @param  paramsCnt Number of function parameters.
- * @param  params    Function parameters values converted to strings.
- * @return           Message composed.
+ * @param  params    Function parameters values in typed encoding.
+ * @return           Message composed (NULL if it can not be allocated).
  */
 char *composeMsg(enum functions function, int paramsCnt, char *params[]) {
+   const char *type = funList[function] == 1 ? "NOTIFY\r\n" : "CONTROL\r\n";
+   // Compute length of the message (type, function name, parameters and ending CRLF)
+   size_t length = strlen(type) + strlen(funName[function]) + 4;
+   for (int i = 0; i < paramsCnt; ++i) {
+      length += strlen(params[i]) + 2;
+   }
    // Alloc space for message
    char *resultMsg;
-   if ((resultMsg = malloc(250 * sizeof(char))) == NULL) {
+   if ((resultMsg = malloc((length + 1) * sizeof(char))) == NULL) {
       fprintf(stderr, "Malloc error\n");
       return NULL;
    }
-   // Write message type
-   strcpy(resultMsg, funList[function] == 1 ? "NOTIFY\r\n" : "CONTROL\r\n");
-
-   // Write function name
-   strcat(resultMsg, funName[function]);
-   strcat(resultMsg, "\r\n");
+   // Write message type and function name
+   char *end = stpcpy(resultMsg, type);
+   end = stpcpy(end, funName[function]);
+   end = stpcpy(end, "\r\n");
    // Write parameters
    for (int i = 0; i < paramsCnt; ++i) {
-      strcat(resultMsg, params[i]);
-      strcat(resultMsg, "\r\n");
+      end = stpcpy(end, params[i]);
+      end = stpcpy(end, "\r\n");
    }
    // Write ending CRLF
-   strcat(resultMsg, "\r\n");
+   strcpy(end, "\r\n");
 
    return resultMsg;
 }
@@ -295,7 +376,7 @@ char *composeMsg(enum functions function, int paramsCnt, char *params[]) {
  * receiving and parsing answer.
  * @param  function  Function from which the initialisation is called.
  * @param  paramsCnt Function parameters count.
- * @param  params    Function parameters values converted to strings.
+ * @param  params    Function parameters values in typed encoding.
  * @return           Structure containing parsed incoming message.
  */
 TInMsg *initFunction(enum functions function, int paramsCnt, char *params[]) {
@@ -304,7 +385,9 @@ TInMsg *initFunction(enum functions function, int paramsCnt, char *params[]) {
    if (funList[function]) {
       // Compose and send message
       char *outMsg = composeMsg(function, paramsCnt, params);
-      send(socketFd, outMsg, strlen(outMsg), 0);
+      if (outMsg == NULL)
+         return NULL;
+      sendMsg(outMsg);
       free(outMsg);
 
       // Receive and parse answer
@@ -331,11 +414,11 @@ TInMsg *initFunction(enum functions function, int paramsCnt, char *params[]) {
 /**
  * @brief Send return message.
  * Send message of type RETURN containing return value of the call.
- * @param returnVal String with return value.
+ * @param returnVal Return value in typed encoding (see composeMsg), empty for void functions.
  */
 void sendReturnMsg(char *returnVal) {
    char *msg;
-   if ((msg = malloc(20 * sizeof(char))) == NULL) {
+   if ((msg = malloc(40 * sizeof(char))) == NULL) {
       fprintf(stderr, "Malloc error");
       return;
    }
@@ -344,7 +427,7 @@ void sendReturnMsg(char *returnVal) {
    strcat(msg, returnVal);
    strcat(msg, "\r\n\r\n");
    // Send message
-   send(socketFd, msg, strlen(msg), 0);
+   sendMsg(msg);
    free(msg);
    // Receive answer
    char inMsgBuf[10];
@@ -359,11 +442,11 @@ ssize_t read(int fd, void *buf, size_t count) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%p", buf);
-   sprintf(paramsStr[2], "%zu", count);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", buf);
+   snprintf(paramsStr[2], PARAM_SIZE, "u%zu", count);
 
    TInMsg *inMsg = initFunction(READ, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -394,7 +477,7 @@ ssize_t read(int fd, void *buf, size_t count) {
          normal = 1;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -406,8 +489,8 @@ ssize_t read(int fd, void *buf, size_t count) {
    ssize_t returnVal = read_orig(fd, buf, count);
    if (funList[READ]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%zd", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%zd", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -419,11 +502,11 @@ ssize_t write(int fd, const void *buf, size_t count) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%p", buf);
-   sprintf(paramsStr[2], "%zu", count);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", buf);
+   snprintf(paramsStr[2], PARAM_SIZE, "u%zu", count);
 
    TInMsg *inMsg = initFunction(WRITE, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -460,7 +543,7 @@ ssize_t write(int fd, const void *buf, size_t count) {
          normal = 1;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -472,8 +555,8 @@ ssize_t write(int fd, const void *buf, size_t count) {
    ssize_t returnVal = write_orig(fd, buf, count);
    if (funList[WRITE]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%zd", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%zd", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -495,12 +578,12 @@ int open(const char *pathname, int flags, ...) {
    // Convert parameters to strings
    char *paramsStr[paramsCnt];
    for (int i = 0; i < paramsCnt; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%d", flags);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", flags);
    if (paramsCnt == 3) {
-      sprintf(paramsStr[2], "%lo", (unsigned long) mode);
+      snprintf(paramsStr[2], PARAM_SIZE, "o%lo", (unsigned long) mode);
    }
 
    TInMsg *inMsg = initFunction(OPEN, paramsCnt, paramsStr);
@@ -584,7 +667,7 @@ int open(const char *pathname, int flags, ...) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -596,8 +679,8 @@ int open(const char *pathname, int flags, ...) {
    int returnVal = open_orig(pathname, flags, mode);
    if (funList[OPEN]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -619,12 +702,12 @@ int open64(const char *pathname, int flags, ...) {
    // Convert parameters to strings
    char *paramsStr[paramsCnt];
    for (int i = 0; i < paramsCnt; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%d", flags);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", flags);
    if (paramsCnt == 3) {
-      sprintf(paramsStr[2], "%lo", (unsigned long) mode);
+      snprintf(paramsStr[2], PARAM_SIZE, "o%lo", (unsigned long) mode);
    }
 
    TInMsg *inMsg = initFunction(OPEN64, paramsCnt, paramsStr);
@@ -708,7 +791,7 @@ int open64(const char *pathname, int flags, ...) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -719,8 +802,8 @@ int open64(const char *pathname, int flags, ...) {
    int returnVal = open64_orig(pathname, flags, mode);
    if (funList[OPEN64]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -731,8 +814,8 @@ int open64(const char *pathname, int flags, ...) {
 int close(int fd) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%d", fd);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
 
    TInMsg *inMsg = initFunction(CLOSE, 1, paramsStr);
    free(paramsStr[0]);
@@ -753,7 +836,7 @@ int close(int fd) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -764,8 +847,8 @@ int close(int fd) {
    int returnVal = close_orig(fd);
    if (funList[CLOSE]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -777,11 +860,11 @@ off_t lseek(int fd, off_t offset, int whence) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%jd", offset);
-   sprintf(paramsStr[2], "%d", whence);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%jd", offset);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", whence);
 
    TInMsg *inMsg = initFunction(LSEEK, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -801,7 +884,7 @@ off_t lseek(int fd, off_t offset, int whence) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -812,8 +895,8 @@ off_t lseek(int fd, off_t offset, int whence) {
    off_t returnVal = lseek_orig(fd, offset, whence);
    if (funList[LSEEK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%jd", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%jd", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -825,10 +908,10 @@ int creat(const char *pathname, mode_t mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%lo", (unsigned long) mode);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "o%lo", (unsigned long) mode);
 
    TInMsg *inMsg = initFunction(CREAT, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -881,7 +964,7 @@ int creat(const char *pathname, mode_t mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -892,8 +975,8 @@ int creat(const char *pathname, mode_t mode) {
    int returnVal = creat_orig(pathname, mode);
    if (funList[CREAT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -905,10 +988,10 @@ int creat64(const char *pathname, mode_t mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%lo", (unsigned long) mode);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "o%lo", (unsigned long) mode);
 
    TInMsg *inMsg = initFunction(CREAT64, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -961,7 +1044,7 @@ int creat64(const char *pathname, mode_t mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -972,8 +1055,8 @@ int creat64(const char *pathname, mode_t mode) {
    int returnVal = creat64_orig(pathname, mode);
    if (funList[CREAT64]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -985,10 +1068,10 @@ int link(const char *oldpath, const char *newpath) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], oldpath);
-   strcpy(paramsStr[1], newpath);
+   stringParam(&paramsStr[0], oldpath);
+   stringParam(&paramsStr[1], newpath);
 
    TInMsg *inMsg = initFunction(LINK, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1044,7 +1127,7 @@ int link(const char *oldpath, const char *newpath) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1055,8 +1138,8 @@ int link(const char *oldpath, const char *newpath) {
    int returnVal = link_orig(oldpath, newpath);
    if (funList[LINK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1068,10 +1151,10 @@ int symlink(const char *oldpath, const char *newpath) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], oldpath);
-   strcpy(paramsStr[1], newpath);
+   stringParam(&paramsStr[0], oldpath);
+   stringParam(&paramsStr[1], newpath);
 
    TInMsg *inMsg = initFunction(SYMLINK, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1124,7 +1207,7 @@ int symlink(const char *oldpath, const char *newpath) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1135,8 +1218,8 @@ int symlink(const char *oldpath, const char *newpath) {
    int returnVal = symlink_orig(oldpath, newpath);
    if (funList[SYMLINK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1147,8 +1230,8 @@ int symlink(const char *oldpath, const char *newpath) {
 int unlink(const char *pathname) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   strcpy(paramsStr[0], pathname);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   stringParam(&paramsStr[0], pathname);
 
    TInMsg *inMsg = initFunction(UNLINK, 1, paramsStr);
    free(paramsStr[0]);
@@ -1193,7 +1276,7 @@ int unlink(const char *pathname) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1204,8 +1287,8 @@ int unlink(const char *pathname) {
    int returnVal = unlink_orig(pathname);
    if (funList[UNLINK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1217,10 +1300,10 @@ int __xstat(int var, const char *path, struct stat *buf) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], path);
-   sprintf(paramsStr[1], "%p", buf);
+   stringParam(&paramsStr[0], path);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", buf);
 
    TInMsg *inMsg = initFunction(STAT, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1255,7 +1338,7 @@ int __xstat(int var, const char *path, struct stat *buf) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1266,8 +1349,8 @@ int __xstat(int var, const char *path, struct stat *buf) {
    int returnVal = xstat_orig(var, path, buf);
    if (funList[STAT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1279,10 +1362,10 @@ int __lxstat(int var, const char *path, struct stat *buf) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], path);
-   sprintf(paramsStr[1], "%p", buf);
+   stringParam(&paramsStr[0], path);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", buf);
 
    TInMsg *inMsg = initFunction(LSTAT, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1317,7 +1400,7 @@ int __lxstat(int var, const char *path, struct stat *buf) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1328,8 +1411,8 @@ int __lxstat(int var, const char *path, struct stat *buf) {
    int returnVal = lxstat_orig(var, path, buf);
    if (funList[LSTAT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1341,10 +1424,10 @@ int __fxstat(int var, int fd, struct stat *buf) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%p", buf);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", buf);
 
    TInMsg *inMsg = initFunction(FSTAT, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1367,7 +1450,7 @@ int __fxstat(int var, int fd, struct stat *buf) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1378,8 +1461,8 @@ int __fxstat(int var, int fd, struct stat *buf) {
    int returnVal = fxstat_orig(var, fd, buf);
    if (funList[FSTAT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1391,10 +1474,10 @@ int access(const char *pathname, int mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%d", mode);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", mode);
 
    TInMsg *inMsg = initFunction(ACCESS, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1439,7 +1522,7 @@ int access(const char *pathname, int mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1450,8 +1533,8 @@ int access(const char *pathname, int mode) {
    int returnVal = access_orig(pathname, mode);
    if (funList[ACCESS]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1463,10 +1546,10 @@ int chmod(const char *path, mode_t mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], path);
-   sprintf(paramsStr[1], "%lo", (unsigned long) mode);
+   stringParam(&paramsStr[0], path);
+   snprintf(paramsStr[1], PARAM_SIZE, "o%lo", (unsigned long) mode);
 
    TInMsg *inMsg = initFunction(CHMOD, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1510,7 +1593,7 @@ int chmod(const char *path, mode_t mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1521,8 +1604,8 @@ int chmod(const char *path, mode_t mode) {
    int returnVal = chmod_orig(path, mode);
    if (funList[CHMOD]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1534,10 +1617,10 @@ int fchmod(int fd, mode_t mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%lo", (unsigned long) mode);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "o%lo", (unsigned long) mode);
 
    TInMsg *inMsg = initFunction(FCHMOD, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1563,7 +1646,7 @@ int fchmod(int fd, mode_t mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1574,8 +1657,8 @@ int fchmod(int fd, mode_t mode) {
    int returnVal = fchmod_orig(fd, mode);
    if (funList[FCHMOD]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1587,10 +1670,10 @@ int flock(int fd, int operation) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%d", operation);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", operation);
 
    TInMsg *inMsg = initFunction(FLOCK, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1616,7 +1699,7 @@ int flock(int fd, int operation) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1627,8 +1710,8 @@ int flock(int fd, int operation) {
    int returnVal = flock_orig(fd, operation);
    if (funList[FLOCK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1639,8 +1722,8 @@ int flock(int fd, int operation) {
 DIR *opendir(const char *name) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   strcpy(paramsStr[0], name);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   stringParam(&paramsStr[0], name);
 
    TInMsg *inMsg = initFunction(OPENDIR, 1, paramsStr);
    free(paramsStr[0]);
@@ -1673,7 +1756,7 @@ DIR *opendir(const char *name) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("NULL");
+         sendReturnMsg("p0");
          return NULL;
       }
    }
@@ -1684,8 +1767,8 @@ DIR *opendir(const char *name) {
    DIR *returnVal = opendir_orig(name);
    if (funList[OPENDIR]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%p", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "p%p", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1696,8 +1779,8 @@ DIR *opendir(const char *name) {
 struct dirent *readdir(DIR *dirp) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%p", dirp);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", dirp);
 
    TInMsg *inMsg = initFunction(READDIR, 1, paramsStr);
    free(paramsStr[0]);
@@ -1712,7 +1795,7 @@ struct dirent *readdir(DIR *dirp) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("NULL");
+         sendReturnMsg("p0");
          return NULL;
       }
    }
@@ -1723,8 +1806,8 @@ struct dirent *readdir(DIR *dirp) {
    struct dirent *returnVal = readdir_orig(dirp);
    if (funList[READDIR]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%p", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "p%p", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1735,8 +1818,8 @@ struct dirent *readdir(DIR *dirp) {
 int closedir(DIR *dirp) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%p", dirp);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", dirp);
 
    TInMsg *inMsg = initFunction(CLOSEDIR, 1, paramsStr);
    free(paramsStr[0]);
@@ -1751,7 +1834,7 @@ int closedir(DIR *dirp) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1762,8 +1845,8 @@ int closedir(DIR *dirp) {
    int returnVal = closedir_orig(dirp);
    if (funList[CLOSEDIR]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1775,10 +1858,10 @@ int mkdir(const char *pathname, mode_t mode) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], pathname);
-   sprintf(paramsStr[1], "%lo", (unsigned long) mode);
+   stringParam(&paramsStr[0], pathname);
+   snprintf(paramsStr[1], PARAM_SIZE, "o%lo", (unsigned long) mode);
 
    TInMsg *inMsg = initFunction(MKDIR, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -1831,7 +1914,7 @@ int mkdir(const char *pathname, mode_t mode) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1842,8 +1925,8 @@ int mkdir(const char *pathname, mode_t mode) {
    int returnVal = mkdir_orig(pathname, mode);
    if (funList[MKDIR]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1854,8 +1937,8 @@ int mkdir(const char *pathname, mode_t mode) {
 int rmdir(const char *pathname) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   strcpy(paramsStr[0], pathname);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   stringParam(&paramsStr[0], pathname);
 
    TInMsg *inMsg = initFunction(RMDIR, 1, paramsStr);
    free(paramsStr[0]);
@@ -1897,7 +1980,7 @@ int rmdir(const char *pathname) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1908,8 +1991,8 @@ int rmdir(const char *pathname) {
    int returnVal = rmdir_orig(pathname);
    if (funList[RMDIR]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1920,8 +2003,8 @@ int rmdir(const char *pathname) {
 int fsync(int fd) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%d", fd);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
 
    TInMsg *inMsg = initFunction(FSYNC, 1, paramsStr);
    free(paramsStr[0]);
@@ -1942,7 +2025,7 @@ int fsync(int fd) {
          break;
       }
       if (!normal) {
-         sendReturnMsg("-1");
+         sendReturnMsg("d-1");
          return -1;
       }
    }
@@ -1953,8 +2036,8 @@ int fsync(int fd) {
    int returnVal = fsync_orig(fd);
    if (funList[FSYNC]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -1970,14 +2053,14 @@ void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
    // Convert parameters to strings
    char *paramsStr[6];
    for (int i = 0; i < 6; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%p", addr);
-   sprintf(paramsStr[1], "%zu", length);
-   sprintf(paramsStr[2], "%d", prot);
-   sprintf(paramsStr[3], "%d", flags);
-   sprintf(paramsStr[4], "%d", fd);
-   sprintf(paramsStr[5], "%jd", length);
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", addr);
+   snprintf(paramsStr[1], PARAM_SIZE, "u%zu", length);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", prot);
+   snprintf(paramsStr[3], PARAM_SIZE, "d%d", flags);
+   snprintf(paramsStr[4], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[5], PARAM_SIZE, "d%jd", length);
 
    initFunction(MMAP, 6, paramsStr);
    for (int i = 0; i < 6; ++i) {
@@ -1990,8 +2073,8 @@ void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
    void *returnVal = mmap_orig(addr, length, prot, flags, fd, offset);
    if (funList[MMAP]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%p", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "p%p", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2003,10 +2086,10 @@ int munmap(void *addr, size_t length) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%p", addr);
-   sprintf(paramsStr[1], "%zu", length);
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", addr);
+   snprintf(paramsStr[1], PARAM_SIZE, "u%zu", length);
 
    initFunction(MUNMAP, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -2019,8 +2102,8 @@ int munmap(void *addr, size_t length) {
    int returnVal = munmap_orig(addr, length);
    if (funList[MUNMAP]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2032,10 +2115,10 @@ int mlock(const void *addr, size_t length) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%p", addr);
-   sprintf(paramsStr[1], "%zu", length);
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", addr);
+   snprintf(paramsStr[1], PARAM_SIZE, "u%zu", length);
 
    initFunction(MLOCK, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -2048,8 +2131,8 @@ int mlock(const void *addr, size_t length) {
    int returnVal = mlock_orig(addr, length);
    if (funList[MLOCK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2061,10 +2144,10 @@ int munlock(const void *addr, size_t length) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%p", addr);
-   sprintf(paramsStr[1], "%zu", length);
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", addr);
+   snprintf(paramsStr[1], PARAM_SIZE, "u%zu", length);
 
    initFunction(MUNLOCK, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -2076,8 +2159,8 @@ int munlock(const void *addr, size_t length) {
    munlock_orig = dlsym(RTLD_NEXT, "munlock");
    int returnVal = munlock_orig(addr, length);
    // Send return value to the controller
-   char *returnValStr = malloc(20 * sizeof(char));
-   sprintf(returnValStr, "%d", returnVal);
+   char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+   snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
    sendReturnMsg(returnValStr);
    free(returnValStr);
    // Return value
@@ -2087,8 +2170,8 @@ int munlock(const void *addr, size_t length) {
 int mlockall(int flags) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%d", flags);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", flags);
 
    initFunction(MLOCKALL, 1, paramsStr);
    free(paramsStr[0]);
@@ -2099,8 +2182,8 @@ int mlockall(int flags) {
    int returnVal = mlockall_orig(flags);
    if (funList[MLOCKALL]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2117,8 +2200,8 @@ int munlockall(void) {
    int returnVal = munlockall_orig();
    if (funList[MUNLOCKALL]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2129,8 +2212,8 @@ int munlockall(void) {
 int brk(void *addr) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%p", addr);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", addr);
 
    initFunction(BRK, 1, paramsStr);
    free(paramsStr[0]);
@@ -2141,8 +2224,8 @@ int brk(void *addr) {
    int returnVal = brk_orig(addr);
    if (funList[BRK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2154,13 +2237,13 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *exceptfds, struc
    // Convert parameters to strings
    char *paramsStr[5];
    for (int i = 0; i < 5; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", nfds);
-   sprintf(paramsStr[1], "%p", readfds);
-   sprintf(paramsStr[2], "%p", writefds);
-   sprintf(paramsStr[3], "%p", exceptfds);
-   sprintf(paramsStr[4], "%p", timeout);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", nfds);
+   snprintf(paramsStr[1], PARAM_SIZE, "p%p", readfds);
+   snprintf(paramsStr[2], PARAM_SIZE, "p%p", writefds);
+   snprintf(paramsStr[3], PARAM_SIZE, "p%p", exceptfds);
+   snprintf(paramsStr[4], PARAM_SIZE, "p%p", timeout);
 
    initFunction(SELECT, 5, paramsStr);
    for (int i = 0; i < 5; ++i) {
@@ -2173,8 +2256,8 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *exceptfds, struc
    int returnVal = select_orig(nfds, readfds, writefds, exceptfds, timeout);
    if (funList[SELECT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2186,11 +2269,11 @@ int poll(struct pollfd *fds, nfds_t nfds, int timeout) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%p", fds);
-   sprintf(paramsStr[1], "%d", (int) nfds);
-   sprintf(paramsStr[2], "%d", timeout);
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", fds);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", (int) nfds);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", timeout);
 
    initFunction(POLL, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -2203,8 +2286,8 @@ int poll(struct pollfd *fds, nfds_t nfds, int timeout) {
    int returnVal = poll_orig(fds, nfds, timeout);
    if (funList[POLL]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2215,8 +2298,8 @@ int poll(struct pollfd *fds, nfds_t nfds, int timeout) {
 int dup(int oldfd) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%d", oldfd);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", oldfd);
 
    initFunction(DUP, 1, paramsStr);
    free(paramsStr[0]);
@@ -2227,8 +2310,8 @@ int dup(int oldfd) {
    int returnVal = dup_orig(oldfd);
    if (funList[DUP]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2240,10 +2323,10 @@ int dup2(int oldfd, int newfd) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", oldfd);
-   sprintf(paramsStr[1], "%d", newfd);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", oldfd);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", newfd);
 
    initFunction(DUP2, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -2256,8 +2339,8 @@ int dup2(int oldfd, int newfd) {
    int returnVal = dup2_orig(oldfd, newfd);
    if (funList[DUP2]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2269,11 +2352,11 @@ int shmget(key_t key, size_t size, int shmflg) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", key);
-   sprintf(paramsStr[1], "%zu", size);
-   sprintf(paramsStr[2], "%d", shmflg);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", key);
+   snprintf(paramsStr[1], PARAM_SIZE, "u%zu", size);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", shmflg);
 
    initFunction(SHMGET, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -2286,8 +2369,8 @@ int shmget(key_t key, size_t size, int shmflg) {
    int returnVal = shmget_orig(key, size, shmflg);
    if (funList[SHMGET]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2299,11 +2382,11 @@ int chown(const char *path, uid_t owner, gid_t group) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], path);
-   sprintf(paramsStr[1], "%d", owner);
-   sprintf(paramsStr[2], "%d", group);
+   stringParam(&paramsStr[0], path);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", owner);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", group);
 
    initFunction(CHOWN, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -2316,8 +2399,8 @@ int chown(const char *path, uid_t owner, gid_t group) {
    int returnVal = chown_orig(path, owner, group);
    if (funList[CHOWN]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2329,11 +2412,11 @@ int fchown(int fd, uid_t owner, gid_t group) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   sprintf(paramsStr[0], "%d", fd);
-   sprintf(paramsStr[1], "%d", owner);
-   sprintf(paramsStr[2], "%d", group);
+   snprintf(paramsStr[0], PARAM_SIZE, "d%d", fd);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", owner);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", group);
 
    initFunction(FCHOWN, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -2346,8 +2429,8 @@ int fchown(int fd, uid_t owner, gid_t group) {
    int returnVal = fchown_orig(fd, owner, group);
    if (funList[FCHOWN]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2359,11 +2442,11 @@ int lchown(const char *path, uid_t owner, gid_t group) {
    // Convert parameters to strings
    char *paramsStr[3];
    for (int i = 0; i < 3; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], path);
-   sprintf(paramsStr[1], "%d", owner);
-   sprintf(paramsStr[2], "%d", group);
+   stringParam(&paramsStr[0], path);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", owner);
+   snprintf(paramsStr[2], PARAM_SIZE, "d%d", group);
 
    initFunction(LCHOWN, 3, paramsStr);
    for (int i = 0; i < 3; ++i) {
@@ -2376,8 +2459,8 @@ int lchown(const char *path, uid_t owner, gid_t group) {
    int returnVal = lchown_orig(path, owner, group);
    if (funList[LCHOWN]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2390,13 +2473,13 @@ int mount(const char *source, const char *target, const char *filesystemtype,
    // Convert parameters to strings
    char *paramsStr[5];
    for (int i = 0; i < 5; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], source);
-   strcpy(paramsStr[1], target);
-   strcpy(paramsStr[2], filesystemtype);
-   sprintf(paramsStr[3], "%lu", mountflags);
-   sprintf(paramsStr[4], "%p", data);
+   stringParam(&paramsStr[0], source);
+   stringParam(&paramsStr[1], target);
+   stringParam(&paramsStr[2], filesystemtype);
+   snprintf(paramsStr[3], PARAM_SIZE, "u%lu", mountflags);
+   snprintf(paramsStr[4], PARAM_SIZE, "p%p", data);
 
    initFunction(MOUNT, 5, paramsStr);
    for (int i = 0; i < 5; ++i) {
@@ -2409,8 +2492,8 @@ int mount(const char *source, const char *target, const char *filesystemtype,
    int returnVal = mount_orig(source, target, filesystemtype, mountflags, data);
    if (funList[MOUNT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2421,8 +2504,8 @@ int mount(const char *source, const char *target, const char *filesystemtype,
 int umount(const char *target) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   strcpy(paramsStr[0], target);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   stringParam(&paramsStr[0], target);
 
    initFunction(UMOUNT, 1, paramsStr);
    free(paramsStr[0]);
@@ -2433,8 +2516,8 @@ int umount(const char *target) {
    int returnVal = umount_orig(target);
    if (funList[UMOUNT]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2446,10 +2529,10 @@ int umount2(const char *target, int flags) {
    // Convert parameters to strings
    char *paramsStr[2];
    for (int i = 0; i < 2; ++i) {
-      paramsStr[i] = malloc(100 * sizeof(char));
+      paramsStr[i] = malloc(PARAM_SIZE * sizeof(char));
    }
-   strcpy(paramsStr[0], target);
-   sprintf(paramsStr[1], "%d", flags);
+   stringParam(&paramsStr[0], target);
+   snprintf(paramsStr[1], PARAM_SIZE, "d%d", flags);
 
    initFunction(UMOUNT2, 2, paramsStr);
    for (int i = 0; i < 2; ++i) {
@@ -2462,8 +2545,8 @@ int umount2(const char *target, int flags) {
    int returnVal = umount2_orig(target, flags);
    if (funList[UMOUNT2]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%d", returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "d%d", returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2474,8 +2557,8 @@ int umount2(const char *target, int flags) {
 mode_t umask(mode_t mask) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%lo", (unsigned long) mask);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "o%lo", (unsigned long) mask);
 
    initFunction(UMASK, 1, paramsStr);
    free(paramsStr[0]);
@@ -2486,8 +2569,8 @@ mode_t umask(mode_t mask) {
    mode_t returnVal = umask_orig(mask);
    if (funList[UMASK]) {
       // If call is monitored or controlled, send return value to the controller
-      char *returnValStr = malloc(20 * sizeof(char));
-      sprintf(returnValStr, "%lo", (unsigned long) returnVal);
+      char *returnValStr = malloc(RETURN_SIZE * sizeof(char));
+      snprintf(returnValStr, RETURN_SIZE, "o%lo", (unsigned long) returnVal);
       sendReturnMsg(returnValStr);
       free(returnValStr);
    }
@@ -2498,8 +2581,8 @@ mode_t umask(mode_t mask) {
 void rewinddir(DIR *dirp) {
    // Convert parameters to strings
    char *paramsStr[1];
-   paramsStr[0] = malloc(100 * sizeof(char));
-   sprintf(paramsStr[0], "%p", dirp);
+   paramsStr[0] = malloc(PARAM_SIZE * sizeof(char));
+   snprintf(paramsStr[0], PARAM_SIZE, "p%p", dirp);
 
    initFunction(REWINDDIR, 1, paramsStr);
    free(paramsStr[0]);
@@ -0,0 +1,147 @@
+#!/bin/sh
+# Scenario tests of the analyzer, run by "make check" from the root of the repository.
+# Each scenario analyses a test program with two configurations which must give same output.
+
+DIR=$(mktemp -d /tmp/analyzerCheck.XXXXXX) || exit 1
+trap 'rm -rf "$DIR"' EXIT
+FAILED=0
+
+# Tested programs
+T02="tst/02/main"
+FIND="/usr/bin/find tst/02 tst/03 tst/04 tst/05 -name *.txt"
+
+# Writes configuration $DIR/NAME.conf analysing PROGRAM with output of type OUTPUT into
+# $DIR/NAME.OUTPUT, further arguments are additional options replacing the default ones
+# usage: config NAME PROGRAM OUTPUT [OPTION...]
+config() {
+   name=$1
+   program=$2
+   output=$3
+   shift 3
+   {
+      echo "program = $program"
+      for option in "control = all" "notify = all" "variants = access,inval,io" \
+            "scheduler = bfs" "aggregator = base_param" "subroutine = 2"; do
+         case " $* " in
+            *" ${option%% =*} ="*) ;;
+            *) echo "$option" ;;
+         esac
+      done
+      echo "output = $output"
+      echo "destination = $DIR/$name.$output"
+      for option in "$@"; do
+         echo "$option"
+      done
+   } > "$DIR/$name.conf"
+}
+
+# Creates configuration (see config) and runs the analysis
+# usage: analyse NAME PROGRAM OUTPUT [OPTION...]
+analyse() {
+   config "$@"
+   bin/analyzer "$DIR/$1.conf" > /dev/null 2> "$DIR/$1.err" || cat "$DIR/$1.err" >&2
+}
+
+# Compares outputs of two analyses
+# usage: same SCENARIO FILE1 FILE2
+same() {
+   if cmp -s "$DIR/$2" "$DIR/$3"; then
+      echo "passed: $1"
+   else
+      echo "FAILED: $1 ($2 and $3 differ)"
+      FAILED=1
+   fi
+}
+
+# Checks that a value from the report of the analysis is as expected
+# usage: expect SCENARIO NAME REPORT_LINE EXPECTED
+expect() {
+   value=$(sed -n "s/^$3: //p" "$DIR/$2.err")
+   if [ "$value" = "$4" ]; then
+      echo "passed: $1"
+   else
+      echo "FAILED: $1 ($3 of $2 is \"$value\", expected \"$4\")"
+      FAILED=1
+   fi
+}
+
+# Output does not depend on the number of workers
+for output in json dot; do
+   analyse t02_w1_$output "$T02" $output "workers = 1"
+   analyse t02_w4_$output "$T02" $output "workers = 4"
+   same "tst/02 with 1 and 4 workers ($output)" t02_w1_$output.$output t02_w4_$output.$output
+done
+analyse find_w1 "$FIND" json "workers = 1"
+analyse find_w4 "$FIND" json "workers = 4"
+same "find with 1 and 4 workers" find_w1.json find_w4.json
+
+# Output does not depend on whether runs are executed by local or remote workers
+config find_coord "$FIND" json "workers = 3" "coordinator = $DIR/coord.sock"
+bin/analyzer "$DIR/find_coord.conf" > /dev/null 2> "$DIR/find_coord.err" &
+for i in $(seq 50); do
+   [ -S "$DIR/coord.sock" ] && break
+   sleep 0.1
+done
+for i in 1 2 3; do
+   bin/analyzer --worker "$DIR/coord.sock" > /dev/null 2>> "$DIR/worker.err" &
+done
+wait
+same "find with remote workers" find_w1.json find_coord.json
+
+# Jump detectors based on rolling hash and on suffix automaton find same jumps
+for subroutine in 2 3; do
+   analyse t02_window_$subroutine "$T02" json "subroutine = $subroutine" "jumps = window"
+   analyse t02_automaton_$subroutine "$T02" json "subroutine = $subroutine" "jumps = automaton"
+   same "tst/02 with both jump detectors (subroutine $subroutine)" \
+         t02_window_$subroutine.json t02_automaton_$subroutine.json
+   analyse find_window_$subroutine "$FIND" json "subroutine = $subroutine" "jumps = window"
+   analyse find_automaton_$subroutine "$FIND" json "subroutine = $subroutine" "jumps = automaton"
+   same "find with both jump detectors (subroutine $subroutine)" \
+         find_window_$subroutine.json find_automaton_$subroutine.json
+done
+
+# Repeated analysis loads its runs from cache, analysis with changed options or program does not
+LOADED="Number of runs loaded from cache"
+cp tst/02/main "$DIR/main"
+analyse cache1 "$DIR/main" json "cache = $DIR/cache"
+analyse cache2 "$DIR/main" json "cache = $DIR/cache"
+expect "runs are not loaded from empty cache" cache1 "$LOADED" 0
+expect "all runs are loaded from cache" cache2 "$LOADED" 50
+same "tst/02 loaded from cache" t02_w1_json.json cache2.json
+analyse cache_variants "$DIR/main" json "cache = $DIR/cache" "variants = access,inval"
+expect "runs are not loaded with other variants" cache_variants "$LOADED" 0
+analyse cache_control "$DIR/main" json "cache = $DIR/cache" "control = read,open"
+# Initial run does not control any call, so it is same
+expect "only initial run is loaded with other controlled functions" cache_control "$LOADED" 1
+printf '\0' >> "$DIR/main"
+analyse cache_changed "$DIR/main" json "cache = $DIR/cache"
+expect "runs are not loaded for changed program" cache_changed "$LOADED" 0
+
+# Analysis interrupted several times and resumed from checkpoints gives same output as the
+# uninterrupted one
+config resume "$FIND" json "checkpoint = $DIR/resume.ckpt" "interval = 0"
+interrupted=0
+for delay in 0 1 1; do
+   if [ -f "$DIR/resume.ckpt" ]; then
+      bin/analyzer --resume "$DIR/resume.conf" > /dev/null 2>> "$DIR/resume.err" &
+   else
+      bin/analyzer "$DIR/resume.conf" > /dev/null 2>> "$DIR/resume.err" &
+   fi
+   pid=$!
+   for i in $(seq 100); do
+      [ -f "$DIR/resume.ckpt" ] && break
+      sleep 0.05
+   done
+   sleep $delay
+   kill -KILL $pid 2> /dev/null && interrupted=$((interrupted + 1))
+   wait $pid 2> /dev/null
+done
+bin/analyzer --resume "$DIR/resume.conf" > /dev/null 2>> "$DIR/resume.err"
+if [ $interrupted -eq 3 ] && grep -q "^Analysis resumed with" "$DIR/resume.err"; then
+   same "find resumed from checkpoints" find_w1.json resume.json
+else
+   echo "FAILED: find resumed from checkpoints (analysis was not interrupted)"
+   FAILED=1
+fi
+
+exit $FAILED
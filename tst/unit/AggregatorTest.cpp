@@ -0,0 +1,182 @@
+/**
+ * @file AggregatorTest.cpp
+ *
+ * @brief Unit tests of the class Aggregator.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "TestAggregator.h"
+
+#include <deque>
+#include <map>
+#include <random>
+#include <regex>
+#include <set>
+
+namespace {
+
+/**
+ * @brief Edges of each node of the graph read from its JSON output (label and target).
+ * Edges with empty label lead to the final node.
+ */
+typedef std::map<unsigned, std::vector<std::pair<std::string, unsigned>>> Edges;
+
+/**
+ * @brief Reads edges of the graph from its JSON output.
+ * @param json Text of the output.
+ * @return Edges of the graph.
+ */
+Edges readEdges(const std::string &json) {
+   std::regex link("\"source\" : (\\d+),\\s*\"target\" : (\\d+),\\s*\"label\" : \"([^\"]*)\"");
+   Edges edges;
+   for (std::sregex_iterator it(json.begin(), json.end(), link), end; it != end; ++it) {
+      edges[std::stoul((*it)[1])].push_back(std::make_pair((*it)[3], std::stoul((*it)[2])));
+   }
+   return edges;
+}
+
+/**
+ * @brief Adds targets of the edges of the nodes to the sets of the labels.
+ * @param edges Edges of the graph.
+ * @param nodes Nodes whose edges are followed.
+ * @param next Sets of targets by labels (member @a first or @a second is filled).
+ * @param target Member of the pairs in @a next which is filled.
+ * @return @a true if there is a final node among the nodes.
+ */
+template<typename Next>
+bool follow(const Edges &edges, const std::set<unsigned> &nodes, Next &next,
+      std::set<unsigned> Next::mapped_type::*target) {
+   bool final = false;
+   for (auto node : nodes) {
+      auto found = edges.find(node);
+      if (found == edges.end())
+         continue;
+      for (auto &edge : found->second) {
+         if (edge.first.empty())
+            final = true;
+         else
+            (next[edge.first].*target).insert(edge.second);
+      }
+   }
+   return final;
+}
+
+/**
+ * @brief Checks that two graphs accept same sequences of labels.
+ * Sets of nodes reached by same sequences are searched in both graphs at once (subset
+ * construction), each pair of the sets must contain final nodes in both graphs or in none.
+ * @param first Edges of the first graph.
+ * @param second Edges of the second graph.
+ * @return @a true if the graphs accept same sequences.
+ */
+bool sameLanguage(const Edges &first, const Edges &second) {
+   typedef std::pair<std::set<unsigned>, std::set<unsigned>> Sets;
+   Sets start( { 0 }, { 0 });
+   std::set<Sets> visited = { start };
+   std::deque<Sets> queue = { start };
+   while (!queue.empty()) {
+      Sets sets = queue.front();
+      queue.pop_front();
+      std::map<std::string, Sets> next;
+      if (follow(first, sets.first, next, &Sets::first)
+            != follow(second, sets.second, next, &Sets::second))
+         return false;
+      for (auto &sets : next) {
+         if (visited.insert(sets.second).second)
+            queue.push_back(sets.second);
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Counts nodes in JSON output of the graph.
+ * @param json Text of the output.
+ * @return Number of the nodes (including the final one).
+ */
+unsigned countNodes(const std::string &json) {
+   unsigned count = 0;
+   for (size_t i = json.find("\"id\""); i != std::string::npos; i = json.find("\"id\"", i + 1))
+      ++count;
+   return count;
+}
+
+}
+
+TEST(outputDoesNotDependOnOrderOfRuns) {
+   std::vector<std::vector<std::string>> runs = { { "a", "b", "c" }, { "a", "d" }, { "e" },
+         { "a", "b", "f" }, { "e", "a" } };
+   TestAggregator forward(0);
+   for (auto &run : runs)
+      forward.add(run);
+   std::string expected = forward.json();
+
+   TestAggregator backward(0);
+   for (auto run = runs.rbegin(); run != runs.rend(); ++run)
+      backward.add(*run);
+   CHECK(backward.json() == expected);
+   CHECK(backward.nodesCount() == forward.nodesCount());
+}
+
+TEST(nodesAreNumberedBreadthFirstBySortedLabels) {
+   TestAggregator aggregator(0);
+   aggregator.add( { "b", "c" });
+   aggregator.add( { "a" });
+   std::string json = aggregator.json();
+   // Node 1 is reached by "a", node 2 by "b" and node 3 by "c"
+   CHECK(json.find("\"source\" : 0,\n      \"target\" : 1,\n      \"label\" : \"a\"")
+         != std::string::npos);
+   CHECK(json.find("\"source\" : 0,\n      \"target\" : 2,\n      \"label\" : \"b\"")
+         != std::string::npos);
+   CHECK(json.find("\"source\" : 2,\n      \"target\" : 3,\n      \"label\" : \"c\"")
+         != std::string::npos);
+}
+
+TEST(commonEndsOfRunsAreMerged) {
+   TestAggregator original(0), minimized(0);
+   for (auto *aggregator : { &original, &minimized }) {
+      aggregator->add( { "a", "x", "y" });
+      aggregator->add( { "b", "x", "y" });
+      aggregator->add( { "c", "x" });
+   }
+   minimized.minimize();
+   std::string expected = original.json(), json = minimized.json();
+   CHECK(sameLanguage(readEdges(json), readEdges(expected)));
+   // First node, a and b, c, x after a and b, y and x after c (both end runs), the final node
+   CHECK(countNodes(expected) == 10);
+   CHECK(countNodes(json) == 6);
+}
+
+TEST(minimizedGraphAcceptsSameLanguage) {
+   // Runs repeat short sequences, so that graphs with jumps contain cycles
+   std::mt19937 random(3);
+   std::uniform_int_distribution<unsigned> length(0, 30), label(0, 3), repeat(1, 3);
+   for (unsigned size : { 0, 2, 3 }) {
+      for (unsigned graph = 0; graph < 30; ++graph) {
+         TestAggregator original(size), minimized(size);
+         for (unsigned run = 0; run < 20; ++run) {
+            std::vector<std::string> labels;
+            unsigned runLength = length(random);
+            while (labels.size() < runLength) {
+               std::vector<std::string> sequence(2 + label(random) % 3);
+               for (auto &l : sequence)
+                  l = std::string(1, 'a' + label(random));
+               for (unsigned r = repeat(random); r-- > 0;)
+                  labels.insert(labels.end(), sequence.begin(), sequence.end());
+            }
+            original.add(labels);
+            minimized.add(labels);
+         }
+         minimized.minimize();
+         std::string expected = original.json(), json = minimized.json();
+         CHECK(sameLanguage(readEdges(json), readEdges(expected)));
+         CHECK(countNodes(json) <= countNodes(expected));
+      }
+   }
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ConnectionTest.cpp
+ *
+ * @brief Unit tests of the class Connection.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "Connection.h"
+#include "Exceptions/SocketException.h"
+#include "Exceptions/SocketClosedException.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Pair of connections of the ends of a Unix socket pair.
+ */
+struct ConnectionPair {
+   int fds[2]; /**< Descriptors of the ends */
+   Connection *first; /**< Connection of the first end */
+   Connection *second; /**< Connection of the second end */
+
+   /**
+    * @brief Constructor creating the socket pair.
+    */
+   ConnectionPair() {
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+         throw SocketException("Creating socket pair failed");
+      first = new Connection(fds[0]);
+      second = new Connection(fds[1]);
+   }
+   /**
+    * @brief Destructor closing both ends.
+    */
+   ~ConnectionPair() {
+      delete first;
+      delete second;
+   }
+};
+
+}
+
+TEST(messagesKeepTheirBoundaries) {
+   ConnectionPair pair;
+   std::string binary("a\0b\n2\n", 6);
+   pair.first->sendMsg("one\ntwo");
+   pair.first->sendMsg("");
+   pair.first->sendMsg(binary);
+   pair.first->sendMsg("10\n");
+   CHECK(pair.second->recvMsg() == "one\ntwo");
+   CHECK(pair.second->recvMsg() == "");
+   CHECK(pair.second->recvMsg() == binary);
+   CHECK(pair.second->recvMsg() == "10\n");
+}
+
+TEST(longMessageIsReceivedWhole) {
+   ConnectionPair pair;
+   std::string msg;
+   for (unsigned i = 0; msg.size() < (4 << 20); ++i)
+      msg += std::to_string(i) + "\n";
+   // Message does not fit into the socket buffer, so it is sent while being received
+   std::thread sender([&pair, &msg]() {
+      pair.first->sendMsg(msg);
+      pair.first->sendMsg("next");
+   });
+   std::string received = pair.second->recvMsg();
+   std::string next = pair.second->recvMsg();
+   sender.join();
+   CHECK(received == msg);
+   CHECK(next == "next");
+}
+
+TEST(invalidHeaderIsRejected) {
+   ConnectionPair pair;
+   write(pair.fds[0], "x\nabc", 5);
+   bool thrown = false;
+   try {
+      pair.second->recvMsg();
+   }
+   catch (SocketException &) {
+      thrown = true;
+   }
+   CHECK(thrown);
+}
+
+TEST(tooLongMessageIsRejected) {
+   ConnectionPair pair;
+   write(pair.fds[0], "999999999999\n", 13);
+   bool thrown = false;
+   try {
+      pair.second->recvMsg();
+   }
+   catch (SocketException &) {
+      thrown = true;
+   }
+   CHECK(thrown);
+}
+
+TEST(closedConnectionIsReported) {
+   ConnectionPair pair;
+   // Message is cut by closing the connection
+   write(pair.fds[0], "10\nabc", 6);
+   delete pair.first;
+   pair.first = NULL;
+   bool thrown = false;
+   try {
+      pair.second->recvMsg();
+   }
+   catch (SocketClosedException &) {
+      thrown = true;
+   }
+   CHECK(thrown);
+}
+
+TEST(peerOfSameUserIsTrusted) {
+   ConnectionPair pair;
+   CHECK(Connection::isTrusted(pair.fds[0]));
+   CHECK(Connection::isTcp("tcp::7777"));
+   CHECK(!Connection::isTcp("/tmp/analyzer.sock"));
+}
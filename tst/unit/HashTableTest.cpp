@@ -0,0 +1,156 @@
+/**
+ * @file HashTableTest.cpp
+ *
+ * @brief Unit tests of the class HashTable.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "Aggregator/HashTable.h"
+#include "Aggregator/RollingHash.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Creates trace of width 3 from a number.
+ * @param n Number of the trace.
+ * @param labels Filled with labels of the trace (different for each number).
+ * @param indexes Filled with indexes of the trace (starting at n + 1).
+ */
+void createTrace(unsigned n, std::vector<unsigned> &labels, std::vector<unsigned> &indexes) {
+   labels = { n % 7, n / 7 % 11, n / 77 };
+   indexes = { n + 1, n + 2, n + 3 };
+}
+
+/**
+ * @brief Finds the trace and compares found indexes.
+ * Missing trace is inserted into the table (see HashTable::findTrace).
+ * @param table Table with traces.
+ * @param labels Labels of the trace.
+ * @param expected Expected indexes of the trace.
+ * @return @a true if the trace is in the table with expected indexes.
+ */
+bool contains(HashTable &table, const std::vector<unsigned> &labels,
+      const std::vector<unsigned> &expected) {
+   std::vector<unsigned> other(labels.size(), ~0U);
+   const unsigned *found = table.findTrace(RollingHash::of(labels), labels, other);
+   return found != NULL && std::equal(expected.begin(), expected.end(), found);
+}
+
+}
+
+TEST(traceIsInsertedOnlyOnce) {
+   HashTable table(3, 0);
+   std::vector<unsigned> labels = { 1, 2, 3 }, indexes = { 4, 5, 6 }, other = { 7, 8, 9 };
+   uint64_t hash = RollingHash::of(labels);
+   CHECK(table.findTrace(hash, labels, indexes) == NULL);
+   const unsigned *found = table.findTrace(hash, labels, other);
+   CHECK(found != NULL);
+   CHECK(std::equal(indexes.begin(), indexes.end(), found));
+}
+
+TEST(tracesWithSameHashAreDistinguished) {
+   HashTable table(2, 0);
+   std::vector<unsigned> first = { 1, 2 }, second = { 2, 1 };
+   CHECK(table.findTrace(42, first, { 10, 11 }) == NULL);
+   CHECK(table.findTrace(42, second, { 20, 21 }) == NULL);
+   const unsigned *found = table.findTrace(42, first, { 30, 31 });
+   CHECK(found != NULL && found[0] == 10);
+   found = table.findTrace(42, second, { 30, 31 });
+   CHECK(found != NULL && found[0] == 20);
+}
+
+TEST(onlyMatchingTraceIsChanged) {
+   HashTable table(3, 0);
+   std::vector<unsigned> labels = { 1, 2, 3 };
+   uint64_t hash = RollingHash::of(labels);
+   table.findTrace(hash, labels, { 4, 5, 6 });
+   // Indexes differ from the stored ones
+   table.changeTrace(hash, labels, { 4, 5, 7 }, 1, { 8, 9 });
+   CHECK(contains(table, labels, { 4, 5, 6 }));
+   table.changeTrace(hash, labels, { 4, 5, 6 }, 1, { 8, 9 });
+   CHECK(contains(table, labels, { 4, 8, 9 }));
+   // Missing trace is not inserted
+   table.changeTrace(RollingHash::of( { 3, 2, 1 }), { 3, 2, 1 }, { 4, 8, 9 }, 0, { 1, 1, 1 });
+   CHECK(!contains(table, { 3, 2, 1 }, { 1, 1, 1 }));
+}
+
+TEST(grownTableContainsAllTraces) {
+   HashTable table(3, 0);
+   std::vector<unsigned> labels, indexes;
+   for (unsigned n = 0; n < 5000; ++n) {
+      createTrace(n, labels, indexes);
+      CHECK(table.findTrace(RollingHash::of(labels), labels, indexes) == NULL);
+   }
+   for (unsigned n = 0; n < 5000; ++n) {
+      createTrace(n, labels, indexes);
+      CHECK(contains(table, labels, indexes));
+   }
+}
+
+TEST(fullTableKeepsInsertedTraces) {
+   // Slot of width 3 takes 32 bytes, so the table can not grow over 128 slots
+   HashTable table(3, 128 * 32);
+   std::vector<unsigned> labels, indexes;
+   for (unsigned n = 0; n < 1000; ++n) {
+      createTrace(n, labels, indexes);
+      table.findTrace(RollingHash::of(labels), labels, indexes);
+   }
+   unsigned found = 0;
+   for (unsigned n = 0; n < 1000; ++n) {
+      createTrace(n, labels, indexes);
+      if (contains(table, labels, indexes))
+         ++found;
+   }
+   // Table is filled up to three quarters
+   CHECK(found == 96);
+   createTrace(0, labels, indexes);
+   CHECK(contains(table, labels, indexes));
+}
+
+TEST(tableIsSameAfterComposeAndParse) {
+   HashTable table(3, 0), parsed(3, 0);
+   std::vector<unsigned> labels, indexes;
+   for (unsigned n = 0; n < 300; ++n) {
+      createTrace(n, labels, indexes);
+      table.findTrace(RollingHash::of(labels), labels, indexes);
+   }
+   parsed.parse(table.compose());
+   for (unsigned n = 0; n < 300; ++n) {
+      createTrace(n, labels, indexes);
+      CHECK(contains(parsed, labels, indexes));
+   }
+   CHECK(parsed.compose().size() == table.compose().size());
+   createTrace(300, labels, indexes);
+   CHECK(!contains(parsed, labels, indexes));
+}
+
+TEST(invalidTableIsRejected) {
+   HashTable table(2, 0);
+   bool thrown = false;
+   try {
+      // Trace with first index 0
+      table.parse("1 2 1 2 2 0 5");
+   }
+   catch (ProtocolException &) {
+      thrown = true;
+   }
+   CHECK(thrown);
+   thrown = false;
+   try {
+      // Trace of different width
+      table.parse("1 3 1 2 3 3 4 5 6");
+   }
+   catch (ProtocolException &) {
+      thrown = true;
+   }
+   CHECK(thrown);
+}
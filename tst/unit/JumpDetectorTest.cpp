@@ -0,0 +1,125 @@
+/**
+ * @file JumpDetectorTest.cpp
+ *
+ * @brief Unit tests of the classes RollingHash and JumpDetector.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "TestAggregator.h"
+#include "Aggregator/JumpDetector.h"
+#include "Aggregator/RollingHash.h"
+
+#include <random>
+
+namespace {
+
+/**
+ * @brief Jump detector giving access to the hash of its window.
+ */
+class TestJumpDetector: public JumpDetector {
+public:
+   /**
+    * @brief Constructor creating detector with unlimited table.
+    * @param s Minimal subroutine size.
+    * @param a Aggregator with the graph.
+    */
+   TestJumpDetector(int s, Aggregator *a) :
+         JumpDetector(s, a, 0) {
+   }
+   /**
+    * @brief Gets hash of the window.
+    * @return Hash value.
+    */
+   uint64_t getHash() {
+      return hash.getValue();
+   }
+};
+
+}
+
+TEST(rollingHashEqualsHashOfWindow) {
+   std::vector<unsigned> labels = { 7, 3, 9, 9, 1, 4, 3, 8, 2, 5 };
+   const unsigned size = 4;
+   RollingHash hash(size);
+   std::vector<unsigned> window(size, 0);
+   CHECK(hash.getValue() == RollingHash::of(window));
+   // Moving forward over the labels
+   for (unsigned i = 0; i < labels.size(); ++i) {
+      hash.push(labels[i], window.front());
+      window.erase(window.begin());
+      window.push_back(labels[i]);
+      CHECK(hash.getValue() == RollingHash::of(window));
+   }
+   // Moving backward to the beginning
+   for (unsigned i = labels.size() - size; i-- > 0;) {
+      hash.pushFront(labels[i], window.back());
+      window.pop_back();
+      window.insert(window.begin(), labels[i]);
+      CHECK(hash.getValue() == RollingHash::of(window));
+   }
+   hash.clear();
+   CHECK(hash.getValue() == RollingHash::of(std::vector<unsigned>(size, 0)));
+}
+
+TEST(hashDependsOnOrderOfLabels) {
+   CHECK(RollingHash::of( { 1, 2, 3 }) != RollingHash::of( { 3, 2, 1 }));
+   CHECK(RollingHash::of( { 1, 2 }) != RollingHash::of( { 2, 1 }));
+}
+
+TEST(movedWindowEqualsFilledWindow) {
+   // Without own jump detector, so that the graph is a tree with known indexes:
+   // 1 a, 2 b, 3 c, 4 d, 5 e (path from 0), 6 x, 7 y (successors of 2), 8 x, 9 a, 10 b, 11 c
+   TestAggregator aggregator(0);
+   aggregator.add( { "a", "b", "c", "d", "e" });
+   aggregator.add( { "a", "b", "x", "y" });
+   aggregator.add( { "x", "a", "b", "c" });
+   TestJumpDetector moved(3, &aggregator);
+   std::vector<unsigned> path = { 1, 2, 3, 4, 5, 4, 3, 2, 6, 7, 6, 2, 1, 0, 8, 9, 10, 11, 10, 4,
+         5 };
+   for (auto node : path) {
+      moved.moveTo(node);
+      TestJumpDetector filled(3, &aggregator);
+      filled.moveTo(node);
+      CHECK(moved.getHash() == filled.getHash());
+   }
+   // Windows of nodes 3 and 11 have same labels a, b, c
+   TestJumpDetector first(3, &aggregator), second(3, &aggregator);
+   first.moveTo(3);
+   second.moveTo(11);
+   CHECK(first.getHash() == second.getHash());
+   second.moveTo(10);
+   CHECK(first.getHash() != second.getHash());
+}
+
+TEST(detectorsFindSameJumps) {
+   // Runs call subroutines of minimal size in loops, each subroutine calls its own functions.
+   // Longer loops are collapsed earlier by AutomatonJumpDetector, so they are not generated.
+   std::mt19937 random(7);
+   std::uniform_int_distribution<unsigned> length(1, 40), subroutine(0, 3), repeat(1, 3);
+   for (unsigned size = 2; size <= 4; ++size) {
+      for (unsigned graph = 0; graph < 50; ++graph) {
+         TestAggregator window(size, "window"), automaton(size, "automaton");
+         for (unsigned run = 0; run < 20; ++run) {
+            std::vector<std::string> labels;
+            unsigned runLength = length(random);
+            while (labels.size() < runLength) {
+               std::vector<std::string> body;
+               unsigned first = subroutine(random) * size;
+               for (unsigned i = 0; i < size; ++i)
+                  body.push_back(std::string(1, 'a' + first + i));
+               for (unsigned r = repeat(random); r-- > 0;)
+                  labels.insert(labels.end(), body.begin(), body.end());
+            }
+            window.add(labels);
+            automaton.add(labels);
+         }
+         CHECK(window.json() == automaton.json());
+      }
+   }
+}
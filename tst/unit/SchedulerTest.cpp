@@ -0,0 +1,163 @@
+/**
+ * @file SchedulerTest.cpp
+ *
+ * @brief Unit tests of the classes RunPlan and WorkUnit.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "Run.h"
+#include "Scheduler/RunPlan.h"
+#include "Scheduler/WorkUnit.h"
+#include "Parser/InitialMsg.h"
+#include "Parser/OutboundMsg.h"
+#include "Exceptions/ProtocolException.h"
+
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief Adds call to the run.
+ * @param run Run the call is added to.
+ * @param name Name of the function.
+ * @param param Typed value of the only parameter.
+ * @param ret Typed return value.
+ * @param variant Variant of the call.
+ */
+void addCall(Run &run, const char *name, const char *param, const char *ret, int variant) {
+   Call call = run.addCall(name, strlen(name));
+   call.setVariant(variant);
+   run.addParam(param, strlen(param));
+   run.setReturnVal(ret, strlen(ret));
+}
+
+/**
+ * @brief Creates run open, read, read, close where the open (before depth) has variant 2.
+ * @param run Run to be filled.
+ */
+void createRun(Run &run) {
+   addCall(run, "open", "stst/02/file.txt", "d3", 2);
+   addCall(run, "read", "d3", "d5", 0);
+   addCall(run, "read", "d3", "d0", 0);
+   addCall(run, "close", "d3", "d0", 0);
+   run.setDepth(1);
+}
+
+/**
+ * @brief Creates plan of the run from ::createRun, where reads and closes are controlled.
+ * @param plan Plan to be filled.
+ */
+void createPlan(RunPlan &plan) {
+   Run run;
+   createRun(run);
+   InitialMsg msg;
+   msg.setControlType(INCLUDE);
+   msg.addControlFunction("read");
+   msg.addControlFunction("close");
+   plan = RunPlan(&run, &msg);
+}
+
+/**
+ * @brief Checks whether parsing of the text throws ProtocolException.
+ * @param object Object parsing the text.
+ * @param text Text to be parsed.
+ * @return @a true if the exception was thrown.
+ */
+template<typename T>
+bool rejects(T &object, const std::string &text) {
+   try {
+      object.parse(text);
+   }
+   catch (ProtocolException &) {
+      return true;
+   }
+   return false;
+}
+
+}
+
+TEST(planKeepsVariantsBeforeDepthAndControlledCallsAfterIt) {
+   RunPlan plan;
+   createPlan(plan);
+   CHECK(plan.getSize() == 4);
+   CHECK(plan.getDepth() == 1);
+   CHECK(plan.getVariants().size() == 1);
+   CHECK(plan.getVariants()[0] == std::make_pair(0u, 2));
+   CHECK(plan.getControlledCnt() == 3);
+   CHECK(plan.getControlledCall(0) == 1);
+   CHECK(plan.getControlledFunction(0) == READ);
+   CHECK(plan.getControlledCall(2) == 3);
+   CHECK(plan.getControlledFunction(2) == CLOSE);
+}
+
+TEST(planIsSameAfterComposeAndParse) {
+   RunPlan plan, parsed;
+   createPlan(plan);
+   parsed.parse(plan.compose());
+   CHECK(parsed.compose() == plan.compose());
+   CHECK(parsed.getSize() == plan.getSize());
+   CHECK(parsed.getDepth() == plan.getDepth());
+   CHECK(parsed.getVariants() == plan.getVariants());
+   CHECK(parsed.getControlledCnt() == plan.getControlledCnt());
+   CHECK(parsed.getControlledFunction(1) == plan.getControlledFunction(1));
+}
+
+TEST(invalidPlanIsRejected) {
+   RunPlan plan;
+   CHECK(rejects(plan, ""));
+   CHECK(rejects(plan, "4 1 1 0"));
+   // Variant of a call after depth
+   CHECK(rejects(plan, "4 1 1 1 2 0"));
+   // Controlled call after the end of the run
+   CHECK(rejects(plan, "4 1 0 1 4 0"));
+   // Unknown function
+   CHECK(rejects(plan, "4 1 0 1 1 1000"));
+   CHECK(!rejects(plan, "4 1 1 0 2 1 1 0"));
+}
+
+TEST(unitSetsVariantsOfPrefixAndExpandedCall) {
+   RunPlan plan;
+   createPlan(plan);
+   WorkUnit unit(&plan, 2, 1);
+   CHECK(!unit.isInitial());
+   CHECK(unit.getFirstAffectedCall() == 0);
+
+   Run run;
+   createRun(run);
+   run.setDepth(0);
+   for (unsigned i = 0; i < run.getSize(); ++i)
+      delete unit.scheduleCall(run.getCall(i), &run, i);
+   CHECK(run.getCall(0).getVariant() == 2);
+   CHECK(run.getCall(1).getVariant() == 0);
+   CHECK(run.getCall(2).getVariant() == 1);
+   CHECK(run.getCall(3).getVariant() == 0);
+   CHECK(run.getDepth() == 3);
+}
+
+TEST(unitIsSameAfterComposeAndParse) {
+   RunPlan plan;
+   createPlan(plan);
+   WorkUnit unit(&plan, 2, 1), parsed;
+   parsed.parse(unit.compose());
+   CHECK(parsed.compose() == unit.compose());
+   CHECK(!parsed.isInitial());
+   CHECK(parsed.getFirstAffectedCall() == 0);
+
+   WorkUnit initial, parsedInitial(&plan, 3, 1);
+   parsedInitial.parse(initial.compose());
+   CHECK(parsedInitial.isInitial());
+   CHECK(parsedInitial.getFirstAffectedCall() == -1);
+}
+
+TEST(invalidUnitIsRejected) {
+   WorkUnit unit;
+   CHECK(rejects(unit, ""));
+   CHECK(rejects(unit, "1 2 1"));
+   CHECK(rejects(unit, "1 2 1 2 0"));
+}
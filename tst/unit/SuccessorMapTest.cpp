@@ -0,0 +1,73 @@
+/**
+ * @file SuccessorMapTest.cpp
+ *
+ * @brief Unit tests of the class SuccessorMap.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+#include "Aggregator/SuccessorMap.h"
+
+#include <map>
+#include <random>
+
+TEST(successorIsFoundByNodeAndLabel) {
+   SuccessorMap map;
+   map.insert(0, 1, 5);
+   map.insert(0, 2, 6);
+   map.insert(5, 1, 7);
+   CHECK(map.find(0, 1) == 5);
+   CHECK(map.find(0, 2) == 6);
+   CHECK(map.find(5, 1) == 7);
+   CHECK(map.find(5, 2) == 0);
+   CHECK(map.find(1, 0) == 0);
+   // Existing successor is not replaced
+   map.insert(0, 1, 8);
+   CHECK(map.find(0, 1) == 5);
+}
+
+TEST(onlyGivenSuccessorIsErased) {
+   SuccessorMap map;
+   map.insert(3, 4, 9);
+   map.erase(3, 4, 10);
+   CHECK(map.find(3, 4) == 9);
+   map.erase(3, 4, 9);
+   CHECK(map.find(3, 4) == 0);
+   map.insert(3, 4, 11);
+   CHECK(map.find(3, 4) == 11);
+   map.clear();
+   CHECK(map.find(3, 4) == 0);
+}
+
+TEST(mapBehavesAsOrderedMapUnderRandomOperations) {
+   SuccessorMap map;
+   std::map<std::pair<unsigned, unsigned>, unsigned> reference;
+   std::mt19937 random(42);
+   // Few nodes and labels, so that entries are often erased and inserted again
+   std::uniform_int_distribution<unsigned> node(0, 2000), label(0, 20), operation(0, 9);
+   for (unsigned i = 0; i < 200000; ++i) {
+      auto key = std::make_pair(node(random), label(random));
+      unsigned op = operation(random);
+      if (op < 5) {
+         map.insert(key.first, key.second, i + 1);
+         reference.insert(std::make_pair(key, i + 1));
+      }
+      else if (op < 8) {
+         // Erase the stored successor or a different one
+         auto it = reference.find(key);
+         unsigned successor = it != reference.end() && op < 7 ? it->second : i + 1;
+         map.erase(key.first, key.second, successor);
+         if (it != reference.end() && it->second == successor)
+            reference.erase(it);
+      }
+      auto it = reference.find(key);
+      CHECK(map.find(key.first, key.second) == (it == reference.end() ? 0 : it->second));
+   }
+   for (auto &entry : reference)
+      CHECK(map.find(entry.first.first, entry.first.second) == entry.second);
+}
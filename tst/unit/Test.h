@@ -0,0 +1,87 @@
+/**
+ * @file Test.h
+ *
+ * @brief Unit test support.
+ *
+ * Contains macros for defining unit tests and checking their conditions, and the registry of
+ * the tests run by the program bin/unitTests (see main.cpp).
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Exception thrown when a condition of a test does not hold.
+ */
+class TestFailure: public std::runtime_error {
+public:
+   /**
+    * @brief Constructor creating message with position of the failed condition.
+    * @param file Source file of the test.
+    * @param line Line of the condition.
+    * @param condition Text of the condition.
+    */
+   TestFailure(const char *file, int line, const char *condition) :
+         std::runtime_error(std::string(file) + ":" + std::to_string(line) + ": " + condition) {
+   }
+};
+
+/**
+ * @brief Unit test registered by macro TEST.
+ */
+struct TestCase {
+   const char *name; /**< Name of the test */
+   void (*function)(); /**< Function performing the test */
+};
+
+/**
+ * @brief Gets all registered tests.
+ * @return Vector of the tests in order of registration.
+ */
+inline std::vector<TestCase> &testCases() {
+   static std::vector<TestCase> cases;
+   return cases;
+}
+
+/**
+ * @brief Registers the test when a static instance is created.
+ */
+struct TestRegistration {
+   /**
+    * @brief Constructor registering the test.
+    * @param name Name of the test.
+    * @param function Function performing the test.
+    */
+   TestRegistration(const char *name, void (*function)()) {
+      testCases().push_back(TestCase { name, function });
+   }
+};
+
+/**
+ * Defines and registers a test, body of the test follows the macro.
+ */
+#define TEST(name) \
+   static void name(); \
+   static TestRegistration name##Registration(#name, name); \
+   static void name()
+
+/**
+ * Fails the test if the condition does not hold.
+ */
+#define CHECK(condition) \
+   do { \
+      if (!(condition)) \
+         throw TestFailure(__FILE__, __LINE__, #condition); \
+   } while (0)
+
+#endif /* TEST_H_ */
@@ -0,0 +1,104 @@
+/**
+ * @file TestAggregator.h
+ *
+ * @brief TestAggregator class.
+ *
+ * Contains definition of the class TestAggregator used by unit tests of aggregation.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#ifndef TESTAGGREGATOR_H_
+#define TESTAGGREGATOR_H_
+
+#include "Aggregator/Aggregator.h"
+#include "Aggregator/RunFragment.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
+
+/**
+ * @brief Temporary output file of TestAggregator.
+ * Separate base class, so that the path is created before the aggregator opens the file.
+ */
+struct TestOutput {
+   std::string path; /**< Path of the file, unique in the process */
+
+   /**
+    * @brief Constructor creating unique path of the file.
+    */
+   TestOutput() {
+      static unsigned count = 0;
+      path = "/tmp/aggregatorTest." + std::to_string(getpid()) + "." + std::to_string(count++);
+   }
+};
+
+/**
+ * @brief Aggregator of runs given directly by labels of their calls.
+ * Output is written into a temporary file, which is removed by the destructor.
+ */
+class TestAggregator: private TestOutput, public Aggregator {
+public:
+   /**
+    * @brief Constructor creating aggregator with unlimited memory.
+    * @param subroutineSize Minimal subroutine size.
+    * @param jumps Type of jump detector (window or automaton).
+    */
+   TestAggregator(unsigned subroutineSize, std::string jumps = "window") :
+         Aggregator(subroutineSize, jumps, path, 0, "/var/tmp", 0) {
+   }
+   /**
+    * @brief Destructor removing the output file.
+    */
+   virtual ~TestAggregator() {
+      std::remove(path.c_str());
+   }
+
+   /**
+    * @brief Merges run with given labels into the graph.
+    * @param labels Labels of the calls of the run.
+    */
+   void add(const std::vector<std::string> &labels) {
+      next = labels;
+      RunFragment fragment(NULL, this);
+      addRun(&fragment);
+   }
+   /**
+    * @brief Creates output of the graph in JSON syntax.
+    * Can be called only once, further outputs would be appended to the file.
+    * @return Text of the output.
+    */
+   std::string json() {
+      printJson();
+      std::ifstream file(path.c_str());
+      std::stringstream text;
+      text << file.rdbuf();
+      return text.str();
+   }
+
+   /**
+    * @brief Gets labels of the run being merged (see ::add).
+    * @param labels Vector filled with the labels.
+    */
+   void getLabels(Run *, std::vector<std::string> &labels) {
+      labels = next;
+   }
+   /**
+    * @brief Labels are used as texts in output.
+    * @param label Label of the call.
+    * @return The label.
+    */
+   std::string getText(const std::string &label) {
+      return label;
+   }
+protected:
+   std::vector<std::string> next; /**< Labels of the run being merged */
+};
+
+#endif /* TESTAGGREGATOR_H_ */
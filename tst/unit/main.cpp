@@ -0,0 +1,38 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Runner of unit tests.
+ *
+ * Runs all tests registered by macro TEST (see Test.h) and reports the failed ones.
+ *
+ * @author agent <agent@local>
+ *
+ * @date 18.10.2026
+ *
+ * Created on: Oct 18, 2026
+ */
+
+#include "Test.h"
+
+#include <iostream>
+#include <exception>
+
+/**
+ * @brief Runs all registered tests.
+ * @return 0 if all tests passed, otherwise 1.
+ */
+int main() {
+   unsigned failed = 0;
+   for (auto &test : testCases()) {
+      try {
+         test.function();
+      }
+      catch (std::exception &e) {
+         std::cerr << "FAILED " << test.name << ": " << e.what() << std::endl;
+         ++failed;
+      }
+   }
+   std::cerr << testCases().size() - failed << " of " << testCases().size() << " tests passed"
+         << std::endl;
+   return failed ? 1 : 0;
+}